@@ -58,3 +58,86 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+/*
+  Most significant digit first radixsort for pointers to fixed length
+  strings, for keys that are too long or too many for
+  radixsort_for_str_ptr(). The pointers are distributed by one byte at
+  a time, and each bucket is sorted by the following bytes. Bytes that
+  are equal in all keys of a bucket are skipped. Small buckets, and
+  buckets below RADIX_MSD_MAX_LEVEL splits, are sorted by comparing the
+  remaining bytes with my_qsort2().
+*/
+
+#define RADIX_MSD_MIN_BUCKET 64
+#define RADIX_MSD_MAX_LEVEL 16
+
+typedef struct st_radix_suffix
+{
+  size_t offset, length;
+} RADIX_SUFFIX;
+
+static int radix_cmp_suffix(const void *arg, const void *a, const void *b)
+{
+  const RADIX_SUFFIX *suffix= (const RADIX_SUFFIX*) arg;
+  return memcmp(*(const uchar**) a + suffix->offset,
+                *(const uchar**) b + suffix->offset, suffix->length);
+}
+
+static void radixsort_msd(uchar **base, uint number_of_elements,
+                          size_t size_of_element, size_t pos,
+                          uchar **buffer, uint level)
+{
+  uchar **end= base + number_of_elements, **ptr;
+  uint32 count[256];
+  uint i;
+
+  for (; pos < size_of_element; pos++)
+  {
+    if (number_of_elements < RADIX_MSD_MIN_BUCKET ||
+        level >= RADIX_MSD_MAX_LEVEL)
+    {
+      RADIX_SUFFIX suffix;
+      suffix.offset= pos;
+      suffix.length= size_of_element - pos;
+      my_qsort2(base, number_of_elements, sizeof(uchar*),
+                radix_cmp_suffix, &suffix);
+      return;
+    }
+
+    bzero((uchar*) count, sizeof(count));
+    for (ptr= base; ptr < end; ptr++)
+      count[ptr[0][pos]]++;
+    if (count[base[0][pos]] == number_of_elements)
+      continue;                                 /* All keys equal here */
+
+    /* Convert the counts to bucket end positions and distribute */
+    for (i= 1; i < 256; i++)
+      count[i]+= count[i - 1];
+    for (ptr= end; ptr-- != base;)
+      buffer[--count[ptr[0][pos]]]= *ptr;
+    memcpy(base, buffer, number_of_elements * sizeof(uchar*));
+
+    /* count[i] is now the start of bucket i */
+    for (i= 0; i < 256; i++)
+    {
+      uint32 bucket_end= i == 255 ? number_of_elements : count[i + 1];
+      if (bucket_end - count[i] > 1)
+        radixsort_msd(base + count[i], bucket_end - count[i],
+                      size_of_element, pos + 1, buffer, level + 1);
+    }
+    return;
+  }
+}
+
+my_bool radixsort_msd_is_appliccable(uint n_items,
+                                     size_t size_of_element)
+{
+  return n_items >= 1000 && size_of_element > 0;
+}
+
+void radixsort_msd_for_str_ptr(uchar **base, uint number_of_elements,
+                               size_t size_of_element, uchar **buffer)
+{
+  radixsort_msd(base, number_of_elements, size_of_element, 0, buffer, 0);
+}
@@ -136,6 +136,19 @@ class Bounded_queue
    */
   bool is_initialized() const { return m_queue.max_elements > 0; }
 
+  /**
+    Is the queue full, so that push() would replace the top element?
+   */
+  bool is_full() const { return queue_is_full((&m_queue)); }
+
+  /**
+    The key on top of the queue. Only valid if num_elements() > 0.
+   */
+  Key_type *top() const
+  {
+    return *reinterpret_cast<Key_type**>(queue_top(&m_queue));
+  }
+
 private:
   Key_type         **m_sort_keys;
   size_t             m_compare_length;
@@ -254,7 +254,15 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     param.accepted_rows= &not_used;
 
   param.set_all_read_bits= filesort->set_all_read_bits;
+  param.sort_threads= thd->variables.sort_threads;
   param.unpack= filesort->unpack;
+  /*
+    Rows skipped by a top-N filter in the engine are neither counted in
+    FOUND_ROWS() nor in ROWNUM. Only push it for SELECT, because UPDATE
+    reports the number of found rows as well.
+  */
+  param.allow_topn_filter= join && !filesort->accepted_rows &&
+                           !(join->select_options & OPTION_FOUND_ROWS);
 
   sort->addon_fields=  param.addon_fields;
   sort->sort_keys= param.sort_keys;
@@ -315,12 +323,16 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     size_t min_sort_memory= MY_MAX(MIN_SORT_MEMORY,
                                    param.sort_length*MERGEBUFF2);
     set_if_bigger(min_sort_memory, sizeof(Merge_chunk*)*MERGEBUFF2);
+    /* Sorting with sort_threads needs one more pointer per key */
+    const bool sort_scratch= param.sort_threads > 1;
     while (memory_available >= min_sort_memory)
     {
-      ulonglong keys= memory_available / (param.rec_length + sizeof(char*));
+      ulonglong keys= memory_available /
+                      (param.rec_length + sizeof(char*) * (1 + sort_scratch));
       param.max_keys_per_buffer= (uint) MY_MAX(MERGEBUFF2,
                                                MY_MIN(num_rows, keys));
-      sort->alloc_sort_buffer(param.max_keys_per_buffer, param.rec_length);
+      sort->alloc_sort_buffer(param.max_keys_per_buffer, param.rec_length,
+                              sort_scratch);
       if (sort->sort_buffer_size() > 0)
         break;
       size_t old_memory_available= memory_available;
@@ -468,6 +480,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
       outfile->end_of_file=save_pos;
     }
   }
+  tracker->report_sort_threads(param.sort_threads_used);
   tracker->report_merge_passes_at_end(thd, thd->query_plan_fsort_passes);
   if (unlikely(error))
   {
@@ -782,6 +795,88 @@ static void dbug_print_record(TABLE *table, bool print_rowid)
 #endif 
 
 
+/**
+  Top-N filter that find_all_keys() pushes into a table scan.
+
+  Once the priority queue is full, Bounded_queue::push() discards every row
+  whose sort key is greater than the key on top of the queue. Such rows are
+  rejected already in the engine, before they are returned to the SQL layer.
+  They are still counted in Sort_param::examined_rows, so that
+  r_examined_rows and Rows_examined do not depend on the engine.
+*/
+
+class Filesort_topn_filter : public Handler_topn_filter
+{
+  Sort_param *param;
+  Bounded_queue<uchar, uchar> *pq;
+  uchar *key_buff;
+public:
+  Filesort_topn_filter(Sort_param *param_arg,
+                       Bounded_queue<uchar, uchar> *pq_arg)
+    : param(param_arg), pq(pq_arg), key_buff(NULL) {}
+
+  bool init(THD *thd)
+  {
+    return !(key_buff= (uchar*) thd->alloc(param->sort_length));
+  }
+
+  bool check() override
+  {
+    if (!pq->is_full())
+      return true;
+    /*
+      Compare only the sort key, not the row reference that may follow it:
+      a row is skipped only if push() would certainly discard it.
+    */
+    uint key_length= make_sortkey(param, key_buff);
+    if (memcmp(key_buff, pq->top(), key_length) <= 0)
+      return true;
+    /* The row was read, but it does not reach find_all_keys() */
+    param->examined_rows++;
+    return false;
+  }
+
+  bool depends_on(const Field *field) const override
+  {
+    for (SORT_FIELD *sort_field= param->local_sortorder.begin();
+         sort_field != param->local_sortorder.end();
+         sort_field++)
+    {
+      if (sort_field->field->field_index == field->field_index)
+        return true;
+    }
+    return false;
+  }
+};
+
+
+/**
+  Check whether a top-N filter can be pushed into the table scan.
+
+  The filter evaluates the sort key on the row that the engine has just
+  read, so all sort keys must be stored columns of the sorted table.
+  Skipped rows are not counted in FOUND_ROWS() nor ROWNUM, so the caller
+  must not need those (see Sort_param::allow_topn_filter).
+*/
+
+static bool topn_filter_is_applicable(Sort_param *param, SQL_SELECT *select)
+{
+  if (!param->allow_topn_filter || param->unpack)
+    return false;
+  if (select && select->cond && select->cond->is_expensive())
+    return false;
+  for (SORT_FIELD *sort_field= param->local_sortorder.begin();
+       sort_field != param->local_sortorder.end();
+       sort_field++)
+  {
+    Field *field= sort_field->field;
+    if (!field || field->table != param->sort_form || !field->stored_in_db())
+      return false;
+  }
+  return true;
+}
+
+
 /**
   Search after sort_keys, and write them into tempfile
   (if we run out of space in the sort_keys buffer).
@@ -793,7 +888,9 @@ static void dbug_print_record(TABLE *table, bool print_rowid)
   @param buffpek_pointers  File to write BUFFPEKs describing sorted segments
                            in tempfile.
   @param tempfile          File to write sorted sequences of sortkeys to.
-  @param pq                If !NULL, use it for keeping top N elements
+  @param pq                If !NULL, use it for keeping top N elements.
+                           For a table scan, a Filesort_topn_filter on it
+                           may also be pushed into the engine.
   @param [out] found_rows  The number of FOUND_ROWS().
                            For a query with LIMIT, this value will typically
                            be larger than the function return value.
@@ -845,6 +942,8 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
   ha_rows num_records= 0;
   const bool packed_format= param->is_packed_format();
   const bool using_packed_sortkeys= param->using_packed_sortkeys();
+  Filesort_topn_filter topn_filter(param, pq);
+  bool topn_filter_pushed= false;
 
   DBUG_ENTER("find_all_keys");
   DBUG_PRINT("info",("using: %s",
@@ -873,6 +972,9 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
     if (unlikely(file->ha_rnd_init_with_error(1)))
       DBUG_RETURN(HA_POS_ERROR);
     file->extra_opt(HA_EXTRA_CACHE, thd->variables.read_buff_size);
+    if (pq && topn_filter_is_applicable(param, select) &&
+        !topn_filter.init(thd))
+      topn_filter_pushed= !file->topn_filter_push(&topn_filter);
   }
 
   /* Remember original bitmaps */
@@ -996,6 +1098,8 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
     if (!write_record)
       file->unlock_row();
   }
+  if (topn_filter_pushed)
+    file->cancel_pushed_topn_filter();
   if (!quick_select)
   {
     (void) file->extra(HA_EXTRA_NO_CACHE);	/* End caching of records */
@@ -1028,6 +1132,8 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
   DBUG_RETURN(num_records);
 
 err:
+  if (topn_filter_pushed)
+    file->cancel_pushed_topn_filter();
   sort_form->column_bitmaps_set(save_read_set, save_write_set);
   DBUG_RETURN(HA_POS_ERROR);
 } /* find_all_keys */
@@ -1062,7 +1168,8 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
   Merge_chunk buffpek;
   DBUG_ENTER("write_keys");
 
-  fs_info->sort_buffer(param, count);
+  set_if_bigger(param->sort_threads_used,
+                fs_info->sort_buffer(param, count));
 
   if (!my_b_inited(tempfile) &&
       open_cached_file(tempfile, mysql_tmpdir, TEMP_PREFIX, DISK_BUFFER_SIZE,
@@ -1461,7 +1568,8 @@ static bool save_index(Sort_param *param, uint count,
   DBUG_ENTER("save_index");
   DBUG_ASSERT(table_sort->record_pointers == 0);
 
-  table_sort->sort_buffer(param, count);
+  set_if_bigger(param->sort_threads_used,
+                table_sort->sort_buffer(param, count));
 
   if (param->using_addon_fields())
   {
@@ -1629,6 +1737,161 @@ static bool check_if_pq_applicable(Sort_param *param,
 }
 
 
+/**
+  write_function of the IO_CACHE of a merge worker: the file descriptor
+  is shared, so write with pwrite() at the position of the cache.
+*/
+
+static int merge_worker_write(IO_CACHE *info, const uchar *Buffer,
+                              size_t Count)
+{
+  if (Buffer != info->write_buffer)
+  {
+    Count&= ~(size_t) (IO_SIZE - 1);
+    if (!Count)
+      return 0;
+  }
+  if (mysql_file_pwrite(info->file, Buffer, Count, info->pos_in_file,
+                        info->myflags | MY_NABP))
+    return info->error= -1;
+  info->pos_in_file+= Count;
+  return 0;
+}
+
+
+/** A worker of merge_many_buff_parallel() */
+
+struct Merge_worker
+{
+  Sort_param *param;
+  IO_CACHE *from_file;
+  IO_CACHE to_file;                   // Writes to the output of the pass
+  Sort_buffer sort_buffer;            // Slice of the sort buffer
+  Merge_chunk *buffpek;               // Input chunks of the pass
+  Merge_chunk *result;                // Output chunks of the pass
+  uint first_group, end_group;        // Groups of MERGEBUFF input chunks
+  uint groups;
+  uint maxbuffer;
+  bool error;
+};
+
+
+static void merge_worker(void *arg, uint i)
+{
+  Merge_worker *w= static_cast<Merge_worker*>(arg) + i;
+  for (uint g= w->first_group; g < w->end_group && !w->error; g++)
+  {
+    Merge_chunk *first= w->buffpek + g * MERGEBUFF;
+    Merge_chunk *last= g + 1 == w->groups
+      ? w->buffpek + w->maxbuffer : first + MERGEBUFF - 1;
+    w->error= merge_buffers(w->param, w->from_file, &w->to_file,
+                            w->sort_buffer, w->result + g, first, last, 0);
+  }
+  if (!w->error)
+    w->error= flush_io_cache(&w->to_file);
+}
+
+
+/**
+  Do one pass of merge_many_buff() with sort_threads workers.
+
+  The groups of MERGEBUFF chunks that merge_many_buff() merges one by one
+  are split into contiguous ranges, one per worker. A worker merges its
+  range with its own slice of the sort buffer, and writes the result to
+  to_file with its own IO_CACHE, from the offset of the first chunk of
+  the range in from_file. A merge never writes more than it reads, so the
+  workers do not overwrite each other. The chunks are read with
+  my_b_pread(), which does not use the buffer of from_file.
+
+  @retval  0  The pass is done, buffpek and maxbuffer describe the result
+  @retval  1  Error
+  @retval -1  The pass must be done by merge_many_buff()
+*/
+
+static int merge_many_buff_parallel(Sort_param *param,
+                                    Sort_buffer sort_buffer,
+                                    Merge_chunk *buffpek, uint *maxbuffer,
+                                    IO_CACHE *from_file, IO_CACHE *to_file)
+{
+  THD *thd= current_thd;
+  const uint groups= (*maxbuffer - MERGEBUFF*3/2) / MERGEBUFF + 2;
+  /* Each worker needs space for a few keys of every merged chunk */
+  const size_t min_slice= MY_MAX(MIN_SORT_MEMORY,
+                                 (size_t) param->rec_length * MERGEBUFF2);
+  uint workers= (uint) MY_MIN(MY_MIN(param->sort_threads, groups),
+                              sort_buffer.size() / min_slice);
+  if (workers < 2 || param->unique_buff ||
+      (from_file->myflags & MY_ENCRYPT) || (to_file->myflags & MY_ENCRYPT))
+    return -1;
+  if (to_file->file < 0 && real_open_cached_file(to_file))
+    return 1;
+
+  Merge_worker w[64];
+  Merge_chunk *result;
+  if (!(result= (Merge_chunk*) my_malloc(PSI_INSTRUMENT_ME,
+                                         groups * sizeof *result,
+                                         MYF(MY_WME | MY_THREAD_SPECIFIC))))
+    return 1;
+
+  const size_t slice= sort_buffer.size() / workers;
+  const my_off_t start= buffpek->file_position();
+  uint i, inited= 0;
+  int error= 1;
+  for (i= 0; i < workers; i++, inited++)
+  {
+    w[i].param= param;
+    w[i].from_file= from_file;
+    w[i].sort_buffer= Sort_buffer(sort_buffer.array() + i * slice, slice);
+    w[i].buffpek= buffpek;
+    w[i].result= result;
+    w[i].first_group= groups * i / workers;
+    w[i].end_group= groups * (i + 1) / workers;
+    w[i].groups= groups;
+    w[i].maxbuffer= *maxbuffer;
+    w[i].error= false;
+    if (init_io_cache(&w[i].to_file, to_file->file, DISK_BUFFER_SIZE,
+                      WRITE_CACHE,
+                      buffpek[w[i].first_group * MERGEBUFF].file_position() -
+                      start, 0, MYF(MY_WME)))
+      goto end;
+    w[i].to_file.write_function= merge_worker_write;
+  }
+
+  param->merge_thd= thd;
+  sort_threads_run(workers, merge_worker, w);
+  param->merge_thd= NULL;
+  set_if_bigger(param->sort_threads_used, workers);
+
+  for (i= 0; i < groups; i++)
+  {
+    thd->inc_status_sort_merge_passes();
+    thd->query_plan_fsort_passes++;
+  }
+  for (i= 0; i < workers; i++)
+    if (w[i].error)
+      goto end;
+  if (!param->not_killable && thd->check_killed())
+    goto end;
+
+  /*
+    Let my_b_tell(to_file) return the end of the output, for
+    reinit_io_cache() to set end_of_file when the pass is read.
+  */
+  to_file->pos_in_file= 0;
+  for (i= 0; i < workers; i++)
+    set_if_bigger(to_file->pos_in_file, my_b_tell(&w[i].to_file));
+  memcpy(buffpek, result, groups * sizeof *result);
+  *maxbuffer= groups - 1;
+  error= 0;
+
+end:
+  for (i= 0; i < inited; i++)
+    end_io_cache(&w[i].to_file);
+  my_free(result);
+  return error;
+}
+
+
 /** Merge buffers to make < MERGEBUFF2 buffers. */
 
 int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
@@ -1653,6 +1916,20 @@ int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
       goto cleanup;
     if (reinit_io_cache(to_file,WRITE_CACHE,0L,0,0))
       goto cleanup;
+    if (param->sort_threads > 1)
+    {
+      int res= merge_many_buff_parallel(param, sort_buffer, buffpek,
+                                        maxbuffer, from_file, to_file);
+      if (res > 0)
+        goto cleanup;
+      if (res == 0)
+      {
+        if (flush_io_cache(to_file))
+          break;
+        temp=from_file; from_file=to_file; to_file=temp;
+        continue;
+      }
+    }
     lastbuff=buffpek;
     for (i=0 ; i <= *maxbuffer-MERGEBUFF*3/2 ; i+=MERGEBUFF)
     {
@@ -1834,11 +2111,18 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   uchar *src;
   uchar *unique_buff= param->unique_buff;
   const bool killable= !param->not_killable;
-  THD* const thd=current_thd;
+  /*
+    In the merge workers of merge_many_buff_parallel() the query thread
+    accounts the merges, and the workers only poll its kill flag.
+  */
+  THD* const thd= param->merge_thd ? NULL : current_thd;
   DBUG_ENTER("merge_buffers");
 
-  thd->inc_status_sort_merge_passes();
-  thd->query_plan_fsort_passes++;
+  if (thd)
+  {
+    thd->inc_status_sort_merge_passes();
+    thd->query_plan_fsort_passes++;
+  }
 
   rec_length= param->rec_length;
   res_length= param->res_length;
@@ -1855,7 +2139,10 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   bool offset_for_packing= (flag == 1 && using_packed_sortkeys);
   const bool packed_format= param->is_packed_format();
 
-  maxcount= (ulong) (param->max_keys_per_buffer/((uint) (Tb-Fb) +1));
+  /* A merge worker gets a slice of the sort buffer */
+  const uint max_keys= (uint) MY_MIN(param->max_keys_per_buffer,
+                                     sort_buffer.size() / rec_length);
+  maxcount= (ulong) (max_keys/((uint) (Tb-Fb) +1));
   to_start_filepos= my_b_tell(to_file);
   strpos= sort_buffer.array();
   org_max_rows=max_rows= param->max_rows;
@@ -1922,7 +2209,8 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
 
   while (queue.elements > 1)
   {
-    if (killable && unlikely(thd->check_killed()))
+    if (killable && unlikely(thd ? thd->check_killed() :
+                             param->merge_thd->killed != NOT_KILLED))
       goto err;                               /* purecov: inspected */
 
     for (;;)
@@ -2007,7 +2295,7 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   buffpek= (Merge_chunk*) queue_top(&queue);
   buffpek->set_buffer(sort_buffer.array(),
                       sort_buffer.array() + sort_buffer.size());
-  buffpek->set_max_keys(param->max_keys_per_buffer);
+  buffpek->set_max_keys(max_keys);
 
   /*
     As we know all entries in the buffer are unique, we only have to
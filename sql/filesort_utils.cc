@@ -19,6 +19,10 @@
 #include "sql_const.h"
 #include "sql_sort.h"
 #include "table.h"
+#include "mysqld.h"
+#include <tpool.h>
+#include <condition_variable>
+#include <mutex>
 
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
@@ -100,14 +104,17 @@ double get_merge_many_buffs_cost_fast(ha_rows num_rows,
 */
 
 uchar *Filesort_buffer::alloc_sort_buffer(uint num_records,
-                                          uint record_length)
+                                          uint record_length,
+                                          bool sort_scratch)
 {
   size_t buff_size;
   DBUG_ENTER("alloc_sort_buffer");
   DBUG_EXECUTE_IF("alloc_sort_buffer_fail",
                   DBUG_SET("+d,simulate_out_of_memory"););
 
-  buff_size= ALIGN_SIZE(num_records * (record_length + sizeof(uchar*)));
+  m_sort_scratch= sort_scratch;
+  buff_size= ALIGN_SIZE(num_records * (record_length +
+                                       pointers_per_record() * sizeof(uchar*)));
 
   if (m_rawmem)
   {
@@ -159,30 +166,265 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
-void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
+/** Server-wide pool of @@sort_threads workers, created on first use */
+static tpool::thread_pool *sort_thread_pool;
+static std::mutex sort_thread_pool_mutex;
+
+static void sort_thread_init()
+{
+  my_thread_init();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_thread *psi= PSI_CALL_new_thread(key_thread_sort_worker, NULL, 0);
+  PSI_CALL_set_thread_os_id(psi);
+  PSI_CALL_set_thread(psi);
+#endif
+}
+
+static void sort_thread_end()
+{
+  PSI_CALL_delete_current_thread();
+  my_thread_end();
+}
+
+static tpool::thread_pool *get_sort_thread_pool()
+{
+  std::lock_guard<std::mutex> lock(sort_thread_pool_mutex);
+  if (!sort_thread_pool &&
+      (sort_thread_pool=
+       tpool::create_thread_pool_generic(1, MY_MAX(my_getncpus(), 1))))
+    sort_thread_pool->set_thread_callbacks(sort_thread_init, sort_thread_end);
+  return sort_thread_pool;
+}
+
+
+void sort_threads_end()
+{
+  std::lock_guard<std::mutex> lock(sort_thread_pool_mutex);
+  delete sort_thread_pool;
+  sort_thread_pool= NULL;
+}
+
+
+namespace {
+/** The calls of one sort_threads_run() */
+class Sort_tasks
+{
+  struct Sort_task
+  {
+    tpool::task task;
+    Sort_tasks *tasks;
+    uint i;
+  };
+
+  Sort_task m_tasks[64];
+  void (*m_func)(void *arg, uint i);
+  void *m_arg;
+  uint m_pending;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+
+  static void execute(void *arg)
+  {
+    Sort_task *t= static_cast<Sort_task*>(arg);
+    Sort_tasks *tasks= t->tasks;
+    tasks->m_func(tasks->m_arg, t->i);
+    std::lock_guard<std::mutex> lock(tasks->m_mutex);
+    if (!--tasks->m_pending)
+      tasks->m_cond.notify_one();
+  }
+
+public:
+  Sort_tasks(void (*func)(void *arg, uint i), void *arg) :
+    m_func(func), m_arg(arg), m_pending(0) {}
+
+  void run(tpool::thread_pool *pool, uint n)
+  {
+    DBUG_ASSERT(n <= array_elements(m_tasks));
+    m_pending= n - 1;
+    for (uint i= 1; i < n; i++)
+    {
+      m_tasks[i].task= tpool::task(execute, &m_tasks[i]);
+      m_tasks[i].tasks= this;
+      m_tasks[i].i= i;
+      pool->submit_task(&m_tasks[i].task);
+    }
+    m_func(m_arg, 0);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_pending)
+      m_cond.wait(lock);
+  }
+};
+}
+
+
+void sort_threads_run(uint n, void (*task)(void *arg, uint i), void *arg)
+{
+  tpool::thread_pool *pool= n > 1 ? get_sort_thread_pool() : NULL;
+  if (pool)
+    Sort_tasks(task, arg).run(pool, n);
+  else
+    for (uint i= 0; i < n; i++)
+      task(arg, i);
+}
+
+
+namespace {
+/** Minimum number of keys that a sort_threads worker is given */
+constexpr uint MIN_KEYS_PER_SORT_THREAD= 16384;
+
+/**
+  Merge two adjacent sorted runs of key pointers.
+  On equal keys, the key of the first run is output first.
+*/
+void merge_sorted_keys(uchar **a, uchar **a_end, uchar **b, uchar **b_end,
+                       uchar **to, qsort2_cmp cmp, void *cmp_arg)
+{
+  while (a < a_end && b < b_end)
+    *to++= cmp(cmp_arg, b, a) < 0 ? *b++ : *a++;
+  if (a < a_end)
+    memcpy(to, a, (a_end - a) * sizeof *a);
+  else if (b < b_end)
+    memcpy(to, b, (b_end - b) * sizeof *b);
+}
+
+/** Runs of key pointers that are sorted by sort_keys_parallel() */
+struct Sort_runs
+{
+  uchar **src, **dst;
+  uint bounds[65];
+  uint runs;
+  size_t radix_length;
+  qsort2_cmp cmp;
+  void *cmp_arg;
+};
+
+/** Sort run i of src, using the same part of dst for radix sort */
+void sort_run(void *arg, uint i)
+{
+  Sort_runs *s= static_cast<Sort_runs*>(arg);
+  uint start= s->bounds[i], n= s->bounds[i + 1] - start;
+  if (s->radix_length)
+    radixsort_msd_for_str_ptr(s->src + start, n, s->radix_length,
+                              s->dst + start);
+  else
+    my_qsort2(s->src + start, n, sizeof *s->src, s->cmp, s->cmp_arg);
+}
+
+/** Merge the runs 2*i and 2*i+1 of src to dst */
+void merge_runs(void *arg, uint i)
+{
+  Sort_runs *s= static_cast<Sort_runs*>(arg);
+  uint r= 2 * i;
+  uchar **a= s->src + s->bounds[r], **a_end= s->src + s->bounds[r + 1];
+  if (r + 1 == s->runs)
+    memcpy(s->dst + s->bounds[r], a, (a_end - a) * sizeof *a);
+  else
+    merge_sorted_keys(a, a_end, a_end, s->src + s->bounds[r + 2],
+                      s->dst + s->bounds[r], s->cmp, s->cmp_arg);
+}
+
+/**
+  Sort key pointers by splitting them into chunks that are sorted by
+  separate threads, and by merging pairs of sorted runs in parallel
+  until one run remains.
+
+  @param keys          key pointers to sort
+  @param buf           space for count key pointers
+  @param count         number of keys
+  @param threads       number of chunks (2..64)
+  @param radix_length  length of memcmp() comparable keys, that chunks
+                       are radix sorted by, or 0 to use cmp
+  @param cmp           comparison function
+  @param cmp_arg       argument of cmp
+*/
+void sort_keys_parallel(uchar **keys, uchar **buf, uint count, uint threads,
+                        size_t radix_length, qsort2_cmp cmp, void *cmp_arg)
+{
+  DBUG_ASSERT(threads > 1);
+  DBUG_ASSERT(threads <= 64);
+  Sort_runs s;
+  s.src= keys;
+  s.dst= buf;
+  s.radix_length= radix_length;
+  s.cmp= cmp;
+  s.cmp_arg= cmp_arg;
+  for (uint i= 0; i <= threads; i++)
+    s.bounds[i]= uint(ulonglong{count} * i / threads);
+
+  sort_threads_run(threads, sort_run, &s);
+
+  /* Merge pairs of runs from src to dst, until one run is left. */
+  for (s.runs= threads; s.runs > 1; )
+  {
+    uint n= (s.runs + 1) / 2;
+    sort_threads_run(n, merge_runs, &s);
+    /* Drop the bounds between the merged runs. */
+    for (uint i= 0; i < n; i++)
+      s.bounds[i]= s.bounds[2 * i];
+    s.bounds[n]= count;
+    s.runs= n;
+    std::swap(s.src, s.dst);
+  }
+
+  if (s.src != keys)
+    memcpy(keys, s.src, count * sizeof *keys);
+}
+}
+
+uint Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
   m_sort_keys= get_sort_keys();
 
   if (count <= 1 || size == 0)
-    return;
+    return 1;
 
   // don't reverse for PQ, it is already done
   if (!param->using_pq)
     reverse_record_pointers();
 
-  uchar **buffer= NULL;
-  if (!param->using_packed_sortkeys() &&
-      radixsort_is_appliccable(count, param->sort_length) &&
-      (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
-                                   MYF(MY_THREAD_SPECIFIC))))
+  const bool fixed_keys= !param->using_packed_sortkeys();
+  const bool lsd= fixed_keys && radixsort_is_appliccable(count, size);
+  /*
+    Fixed-length keys are memcmp() comparable: distribute them by bytes
+    instead of invoking the comparison function O(count*log(count)) times.
+  */
+  const bool msd= fixed_keys && radixsort_msd_is_appliccable(count, size);
+  uint threads= m_sort_scratch && !lsd
+    ? MY_MIN(param->sort_threads, count / MIN_KEYS_PER_SORT_THREAD) : 1;
+
+  /*
+    The radix sorts and the parallel sort need space for count pointers:
+    the pointers that alloc_sort_buffer() reserved below the sort keys,
+    or else a separate allocation.
+  */
+  uchar **buffer= NULL, **allocated= NULL;
+  if (m_sort_scratch)
+  {
+    DBUG_ASSERT(count <= m_idx);
+    buffer= m_sort_keys - count;
+  }
+  else if (lsd || msd)
+    buffer= allocated=
+      (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
+                          MYF(MY_THREAD_SPECIFIC));
+
+  if (buffer && (lsd || msd || threads > 1))
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
-    my_free(buffer);
-    return;
+    if (lsd)
+      radixsort_for_str_ptr(m_sort_keys, count, size, buffer);
+    else if (threads > 1)
+      sort_keys_parallel(m_sort_keys, buffer, count, threads,
+                         msd ? size : 0, param->get_compare_function(),
+                         param->get_compare_argument(&size));
+    else
+      radixsort_msd_for_str_ptr(m_sort_keys, count, size, buffer);
+    my_free(allocated);
+    return MY_MAX(threads, 1);
   }
 
   my_qsort2(m_sort_keys, count, sizeof(uchar*),
             param->get_compare_function(),
             param->get_compare_argument(&size));
+  return 1;
 }
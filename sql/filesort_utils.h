@@ -43,6 +43,17 @@ double get_merge_many_buffs_cost_fast(ha_rows num_rows,
                                       ha_rows num_keys_per_buffer,
                                       uint    elem_size);
 
+/**
+  Run task(arg, i) for i= 0..n-1, and return when all calls have returned.
+  Task 0 runs in the calling thread, the others in the server-wide pool
+  of @@sort_threads workers. The pool runs at most one worker per CPU,
+  however many sorts are running.
+*/
+void sort_threads_run(uint n, void (*task)(void *arg, uint i), void *arg);
+
+/** Stop the pool of @@sort_threads workers. */
+void sort_threads_end();
+
 
 /**
   A wrapper class around the buffer used by filesort().
@@ -78,11 +89,14 @@ class Filesort_buffer
     m_sort_keys(NULL),
     m_num_records(0), m_record_length(0),
     m_sort_length(0),
-    m_size_in_bytes(0), m_idx(0)
+    m_size_in_bytes(0), m_idx(0), m_sort_scratch(false)
   {}
 
-  /** Sort me... */
-  void sort_buffer(const Sort_param *param, uint count);
+  /**
+    Sort me...
+    @return number of threads that sorted the keys
+  */
+  uint sort_buffer(const Sort_param *param, uint count);
 
   /**
     Reverses the record pointer array, to avoid recording new results for
@@ -139,7 +153,7 @@ class Filesort_buffer
     DBUG_ASSERT(m_next_rec_ptr >= m_rawmem);
     const size_t spaceused=
       (m_next_rec_ptr - m_rawmem) +
-      (static_cast<size_t>(m_idx) * sizeof(uchar*));
+      (static_cast<size_t>(m_idx) * pointers_per_record() * sizeof(uchar*));
     return m_size_in_bytes - spaceused;
   }
 
@@ -150,7 +164,8 @@ class Filesort_buffer
   {
     if (m_idx < m_num_records)
       return false;
-    return spaceleft() < (m_record_length + sizeof(uchar*));
+    return spaceleft() <
+           (m_record_length + pointers_per_record() * sizeof(uchar*));
   }
 
   /**
@@ -195,9 +210,12 @@ class Filesort_buffer
 
     @param num_records   Number of records.
     @param record_length (maximum) size of each record.
+    @param sort_scratch  Also reserve one pointer per record, that
+                         sort_buffer() uses to sort with @@sort_threads.
     @returns Pointer to allocated area, or NULL in case of out-of-memory.
   */
-  uchar *alloc_sort_buffer(uint num_records, uint record_length);
+  uchar *alloc_sort_buffer(uint num_records, uint record_length,
+                           bool sort_scratch= false);
 
   /// Frees the buffer.
   void free_sort_buffer();
@@ -252,6 +270,7 @@ class Filesort_buffer
     m_sort_length= rhs.m_sort_length;
     m_size_in_bytes= rhs.m_size_in_bytes;
     m_idx= rhs.m_idx;
+    m_sort_scratch= rhs.m_sort_scratch;
     return *this;
   }
 
@@ -259,6 +278,8 @@ class Filesort_buffer
   void set_sort_length(uint val) { m_sort_length= val; }
 
 private:
+  uint pointers_per_record() const { return m_sort_scratch ? 2 : 1; }
+
   uchar  *m_next_rec_ptr;    /// The next record will be inserted here.
   uchar  *m_rawmem;          /// The raw memory buffer.
   uchar **m_record_pointers; /// The "right-to-left" array of record pointers.
@@ -277,6 +298,7 @@ class Filesort_buffer
     without any casting/warning.
   */
   longlong m_idx;
+  bool    m_sort_scratch;    /// Saved value from alloc_sort_buffer()
 };
 
 int compare_packed_sort_keys(void *sort_keys, unsigned char **a,
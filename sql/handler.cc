@@ -6748,6 +6748,29 @@ check_result_t handler_rowid_filter_check(void *h_arg)
 }
 
 
+/**
+  Top-N filter callback - to be called by an engine after it has unpacked
+  a row of a table scan into buf, to check whether the row can get into the
+  result of the sort with LIMIT that pushed the filter
+*/
+
+extern "C"
+check_result_t handler_topn_filter_check(void *h_arg, const uchar *buf)
+{
+  handler *h= (handler*) h_arg;
+  THD *thd= h->table->in_use;
+
+  enum thd_kill_levels abort_at= h->has_transactions() ?
+    THD_ABORT_SOFTLY : THD_ABORT_ASAP;
+  if (thd_kill_level(thd) > abort_at)
+    return CHECK_ABORTED_BY_USER;
+
+  if (!h->pushed_topn_filter || buf != h->table->record[0])
+    return CHECK_POS;
+  return h->pushed_topn_filter->check() ? CHECK_POS : CHECK_NEG;
+}
+
+
 /**
   Callback function for an engine to check whether the used rowid filter
   has been already built
@@ -7105,6 +7128,7 @@ int handler::ha_reset()
   cancel_pushed_idx_cond();
   /* Reset information about pushed index conditions */
   cancel_pushed_rowid_filter();
+  cancel_pushed_topn_filter();
   if (lookup_handler != this)
   {
     lookup_handler->ha_external_unlock(table->in_use);
@@ -3079,6 +3079,25 @@ extern "C" check_result_t handler_index_cond_check(void* h_arg);
 
 extern "C" check_result_t handler_rowid_filter_check(void* h_arg);
 extern "C" int handler_rowid_filter_is_active(void* h_arg);
+extern "C" check_result_t handler_topn_filter_check(void* h_arg,
+                                                    const uchar *buf);
+
+/**
+  Filter pushed into a table scan by a sort with LIMIT (a "top-N" sort).
+
+  check() examines the row in table->record[0] and returns false when the
+  row can no longer get into the first N rows of the sort, so that the
+  engine may skip it without returning it to the SQL layer. check() reads
+  only the columns for which depends_on() is true, so the engine may unpack
+  just those columns before calling it, and the rest of a row that passes.
+*/
+class Handler_topn_filter
+{
+public:
+  virtual ~Handler_topn_filter() {}
+  virtual bool check()= 0;
+  virtual bool depends_on(const Field *field) const= 0;
+};
 
 uint calculate_key_len(TABLE *, uint, const uchar *, key_part_map);
 /*
@@ -3260,6 +3279,8 @@ class handler :public Sql_alloc
   Rowid_filter *pushed_rowid_filter;
   /* true when the pushed rowid filter has been already filled */
   bool rowid_filter_is_active;
+  /* Top-N filter pushed into the engine by a sort with LIMIT */
+  Handler_topn_filter *pushed_topn_filter;
 
   Discrete_interval auto_inc_interval_for_cur_row;
   /**
@@ -3381,6 +3402,7 @@ class handler :public Sql_alloc
     pushed_idx_cond_keyno(MAX_KEY),
     pushed_rowid_filter(NULL),
     rowid_filter_is_active(0),
+    pushed_topn_filter(NULL),
     auto_inc_intervals_count(0),
     m_psi(NULL),
     m_psi_batch_mode(PSI_BATCH_MODE_NONE),
@@ -4467,6 +4489,19 @@ class handler :public Sql_alloc
 
  virtual bool rowid_filter_push(Rowid_filter *rowid_filter) { return true; }
 
+ /**
+   Push a top-N filter to be checked on the rows of a table scan.
+
+   @return false if the engine is going to apply the filter
+ */
+ virtual bool topn_filter_push(Handler_topn_filter *topn_filter)
+ { return true; }
+
+ virtual void cancel_pushed_topn_filter()
+ {
+   pushed_topn_filter= NULL;
+ }
+
  /* Needed for partition / spider */
   virtual TABLE_LIST *get_next_global_for_child() { return NULL; }
 
@@ -5071,6 +5106,8 @@ class handler :public Sql_alloc
   virtual void set_lock_type(enum thr_lock_type lock);
   friend check_result_t handler_index_cond_check(void* h_arg);
   friend check_result_t handler_rowid_filter_check(void *h_arg);
+  friend check_result_t handler_topn_filter_check(void *h_arg,
+                                                  const uchar *buf);
 
   /**
     Find unique record by index or unique constrain
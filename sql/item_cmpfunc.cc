@@ -3766,6 +3766,42 @@ uchar *in_longlong::get_value(Item *item)
   return (uchar*) &tmp;
 }
 
+
+/*
+  Same as in_vector::find(), but calls cmp_longlong() directly instead of
+  through the 'compare' pointer, so the comparison can be inlined into the
+  bisection loop. This is evaluated once per row for every
+  "expr IN (int_const, ...)" and for the temporal IN lists derived from
+  in_longlong. The value is checked against the smallest and the largest
+  element first, as most of the rows of a selective filter fall outside
+  of the list range.
+*/
+
+bool in_longlong::find(Item *item)
+{
+  packed_longlong *result= (packed_longlong*) get_value(item);
+  if (!result || !used_count)
+    return false;                               // Null value
+
+  packed_longlong *values= (packed_longlong*) base;
+  uint start= 0, end= used_count - 1;
+  if (cmp_longlong(NULL, values, result) > 0 ||
+      cmp_longlong(NULL, values + end, result) < 0)
+    return false;
+  while (start != end)
+  {
+    uint mid= (start + end + 1) / 2;
+    int res;
+    if ((res= cmp_longlong(NULL, values + mid, result)) == 0)
+      return true;
+    if (res < 0)
+      start= mid;
+    else
+      end= mid - 1;
+  }
+  return cmp_longlong(NULL, values + start, result) == 0;
+}
+
 Item *in_longlong::create_item(THD *thd)
 { 
   /* 
@@ -1461,7 +1461,7 @@ class in_vector :public Sql_alloc
   {
     my_qsort2(base,used_count,size,compare,(void*)collation);
   }
-  bool find(Item *item);
+  virtual bool find(Item *item);
   
   /* 
     Create an instance of Item_{type} (e.g. Item_decimal) constant object
@@ -1540,6 +1540,7 @@ class in_longlong :public in_vector
   in_longlong(THD *thd, uint elements);
   void set(uint pos,Item *item) override;
   uchar *get_value(Item *item) override;
+  bool find(Item *item) override;
   Item* create_item(THD *thd) override;
   void value_to_item(uint pos, Item *item) override
   {
@@ -203,6 +203,27 @@ class Table_access_tracker
 };
 
 
+/*
+  A class for tracking how a join buffer was used.
+
+  Each time the join buffer becomes full before all records of the partial
+  join have been put into it, the records collected so far have to be joined
+  with the inner table, which means one more scan of that table. A large
+  number of refills means that join_buffer_size is too small for the join.
+*/
+
+class Join_buffer_tracker
+{
+public:
+  Join_buffer_tracker() : r_refills(0) {}
+
+  ha_rows r_refills; /* How many times the join buffer became full */
+
+  ha_rows get_refills() const { return r_refills; }
+  inline void on_buffer_full() { r_refills++; }
+};
+
+
 class Json_writer;
 
 /*
@@ -223,6 +244,7 @@ class Filesort_tracker : public Sql_alloc
     r_examined_rows(0), r_sorted_rows(0), r_output_rows(0),
     sort_passes(0),
     sort_buffer_size(0),
+    r_sort_threads(0),
     r_using_addons(false),
     r_packed_addon_fields(false),
     r_sort_keys_packed(false)
@@ -268,6 +290,11 @@ class Filesort_tracker : public Sql_alloc
       sort_buffer_size= bufsize;
   }
 
+  inline void report_sort_threads(uint threads)
+  {
+    set_if_bigger(r_sort_threads, threads);
+  }
+
   inline void report_addon_fields_format(bool addons_packed)
   {
     r_using_addons= true;
@@ -340,6 +367,11 @@ class Filesort_tracker : public Sql_alloc
     other          - value
   */
   ulonglong sort_buffer_size;
+  /*
+    Max number of threads that sorted one buffer or did one merge pass
+    (see @@sort_threads)
+  */
+  uint r_sort_threads;
   bool r_using_addons;
   bool r_packed_addon_fields;
   bool r_sort_keys_packed;
@@ -1362,6 +1362,7 @@ void Query_cache::store_query(THD *thd, TABLE_LIST *tables_used)
 {
   TABLE_COUNTER_TYPE local_tables;
   size_t tot_length;
+  my_hash_value_type hash_value;
   const char *query;
   size_t query_length;
   uint8 tables_type;
@@ -1470,6 +1471,36 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
                           (int)flags.in_trans,
                           (int)flags.autocommit));
 
+    query=        thd->base_query.ptr();
+    query_length= thd->base_query.length();
+
+    /* Key is query + database + flag */
+    if (thd->db.length)
+    {
+      memcpy((char*) (query + query_length + 1 + QUERY_CACHE_DB_LENGTH_SIZE),
+             thd->db.str, thd->db.length);
+      DBUG_PRINT("qcache", ("database: %s  length: %u",
+			    thd->db.str, (unsigned) thd->db.length));
+    }
+    else
+    {
+      DBUG_PRINT("qcache", ("No active database"));
+    }
+    tot_length= (query_length + thd->db.length + 1 +
+                 QUERY_CACHE_DB_LENGTH_SIZE + QUERY_CACHE_FLAGS_SIZE);
+    /*
+      We should only copy structure (don't use it location directly)
+      because of alignment issue
+    */
+    memcpy((void*) (query + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
+	   &flags, QUERY_CACHE_FLAGS_SIZE);
+
+    /*
+      The key is built in the thread's own buffer and hashed before taking
+      structure_guard_mutex; the hash function of 'queries' never changes.
+    */
+    hash_value= my_calc_hash(&queries, (uchar*) query, tot_length);
+
     /*
       A table- or a full flush operation can potentially take a long time to
       finish. We choose not to wait for them and skip caching statements
@@ -1497,33 +1528,10 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
       DBUG_VOID_RETURN;
     }
 
-    query=        thd->base_query.ptr();
-    query_length= thd->base_query.length();
-
-    /* Key is query + database + flag */
-    if (thd->db.length)
-    {
-      memcpy((char*) (query + query_length + 1 + QUERY_CACHE_DB_LENGTH_SIZE),
-             thd->db.str, thd->db.length);
-      DBUG_PRINT("qcache", ("database: %s  length: %u",
-			    thd->db.str, (unsigned) thd->db.length));
-    }
-    else
-    {
-      DBUG_PRINT("qcache", ("No active database"));
-    }
-    tot_length= (query_length + thd->db.length + 1 +
-                 QUERY_CACHE_DB_LENGTH_SIZE + QUERY_CACHE_FLAGS_SIZE);
-    /*
-      We should only copy structure (don't use it location directly)
-      because of alignment issue
-    */
-    memcpy((void*) (query + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
-	   &flags, QUERY_CACHE_FLAGS_SIZE);
-
     /* Check if another thread is processing the same query? */
     Query_cache_block *competitor = (Query_cache_block *)
-      my_hash_search(&queries, (uchar*) query, tot_length);
+      my_hash_search_using_hash_value(&queries, hash_value,
+                                      (uchar*) query, tot_length);
     DBUG_PRINT("qcache", ("competitor %p", competitor));
     if (competitor == 0)
     {
@@ -1712,6 +1720,7 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
   Query_cache_block *result_block;
   Query_cache_block_table *block_table, *block_table_end;
   size_t tot_length;
+  my_hash_value_type hash_value;
   Query_cache_query_flags flags;
   const char *sql, *sql_end, *found_brace= 0;
   DBUG_ENTER("Query_cache::send_result_to_client");
@@ -1869,22 +1878,6 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
       goto err;
     }
   }
-  /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
-    disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
-  */
-  if (try_lock(thd, Query_cache::TIMEOUT))
-    goto err;
-
-  if (query_cache_size == 0)
-  {
-    thd->query_cache_is_applicable= 0;            // Query can't be cached
-    goto err_unlock;
-  }
-
   Query_cache_block *query_block;
   if (thd->variables.query_cache_strip_comments)
   {
@@ -1972,14 +1965,37 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
   memcpy((uchar *)(sql + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
 	 (uchar*) &flags, QUERY_CACHE_FLAGS_SIZE);
 
+  /*
+    Hash the key before taking structure_guard_mutex, once for the probe
+    below and a WSREP retry; the hash function of 'queries' never changes.
+  */
+  hash_value= my_calc_hash(&queries, (uchar*) sql, tot_length);
+
+  /*
+    Try to obtain an exclusive lock on the query cache. If the cache is
+    disabled or if a full cache flush is in progress, the attempt to
+    get the lock is aborted.
+
+    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+  */
+  if (try_lock(thd, Query_cache::TIMEOUT))
+    goto err;
+
+  if (query_cache_size == 0)
+  {
+    thd->query_cache_is_applicable= 0;            // Query can't be cached
+    goto err_unlock;
+  }
+
 #ifdef WITH_WSREP
   bool once_more;
   once_more= true;
 lookup:
 #endif /* WITH_WSREP */
 
-  query_block = (Query_cache_block *)  my_hash_search(&queries, (uchar*) sql,
-                                                      tot_length);
+  query_block= (Query_cache_block *)
+    my_hash_search_using_hash_value(&queries, hash_value,
+                                    (uchar*) sql, tot_length);
   /* Quick abort on unlocked data */
   if (query_block == 0 ||
       query_block->query()->result() == 0 ||
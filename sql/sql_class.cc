@@ -3971,6 +3971,13 @@ static uchar *get_stmt_name_hash_key(Statement *entry, size_t *length,
   return (uchar*) entry->name.str;
 }
 
+static uchar *get_stmt_text_hash_key(Statement *entry, size_t *length,
+                                     my_bool not_used __attribute__((unused)))
+{
+  *length= entry->query_length();
+  return (uchar*) entry->query();
+}
+
 C_MODE_END
 
 Statement_map::Statement_map() :
@@ -3987,6 +3994,11 @@ Statement_map::Statement_map() :
   my_hash_init(key_memory_prepared_statement_map, &names_hash, system_charset_info, START_NAME_HASH_SIZE, 0, 0,
                (my_hash_get_key) get_stmt_name_hash_key,
                NULL, MYF(0));
+  my_hash_init(key_memory_prepared_statement_map, &text_query_hash,
+               &my_charset_bin, START_STMT_HASH_SIZE, 0, 0,
+               (my_hash_get_key) get_stmt_text_hash_key,
+               delete_statement_as_hash_key, MYF(0));
+  bzero(text_query_seen, sizeof(text_query_seen));
 }
 
 
@@ -4084,6 +4096,49 @@ void Statement_map::erase(Statement *statement)
 }
 
 
+/*
+  Add a statement prepared for a text query to the text query cache.
+
+  DESCRIPTION
+    The least recently used statements are evicted so that at most
+    max_count statements stay in the cache. The cache has its own limit:
+    cached statements are not counted in prepared_stmt_count and don't
+    take any of the max_prepared_stmt_count statements.
+
+  RETURN VALUE
+    0  success, the map owns the statement
+    1  the statement was not cached, the caller still owns it
+*/
+
+bool Statement_map::insert_text_query(Statement *statement, ulong max_count)
+{
+  if (!max_count)
+    return 1;
+  trim_text_queries(max_count - 1);
+
+  if (my_hash_insert(&text_query_hash, (uchar*) statement))
+    return 1;
+  text_query_lru.push_back(statement);
+  return 0;
+}
+
+
+void Statement_map::erase_text_query(Statement *statement)
+{
+  statement->unlink();
+  my_hash_delete(&text_query_hash, (uchar *) statement);
+}
+
+
+/* Evict least recently used text query statements down to max_count */
+
+void Statement_map::trim_text_queries(ulong max_count)
+{
+  while (text_query_hash.records > max_count)
+    erase_text_query(text_query_lru.head());
+}
+
+
 void Statement_map::reset()
 {
   /* Must be first, hash_free will reset st_hash.records */
@@ -4096,6 +4151,9 @@ void Statement_map::reset()
   }
   my_hash_reset(&names_hash);
   my_hash_reset(&st_hash);
+  /* Statement destructors unlink them from text_query_lru */
+  my_hash_reset(&text_query_hash);
+  bzero(text_query_seen, sizeof(text_query_seen));
   last_found_statement= 0;
 }
 
@@ -4104,8 +4162,10 @@ Statement_map::~Statement_map()
 {
   /* Statement_map::reset() should be called prior to destructor. */
   DBUG_ASSERT(!st_hash.records);
+  DBUG_ASSERT(!text_query_hash.records);
   my_hash_free(&names_hash);
   my_hash_free(&st_hash);
+  my_hash_free(&text_query_hash);
 }
 
 bool my_var_user::set(THD *thd, Item *item)
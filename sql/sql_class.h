@@ -699,6 +699,7 @@ typedef struct system_variables
   ulonglong wsrep_gtid_seq_no;
 #endif /* WITH_WSREP */
   uint eq_range_index_dive_limit;
+  uint sort_threads;
   ulong column_compression_zlib_strategy;
   ulong lock_wait_timeout;
   ulong join_cache_level;
@@ -738,6 +739,7 @@ typedef struct system_variables
   ulong range_alloc_block_size;
   ulong query_alloc_block_size;
   ulong query_prealloc_size;
+  ulong query_prepare_cache_size;
   ulong trans_alloc_block_size;
   ulong trans_prealloc_size;
   ulong log_warnings;
@@ -785,6 +787,7 @@ typedef struct system_variables
   my_bool binlog_annotate_row_events;
   my_bool binlog_direct_non_trans_update;
   my_bool column_compression_zlib_wrap;
+  my_bool prepared_stmt_reuse;
 
   plugin_ref table_plugin;
   plugin_ref tmp_table_plugin;
@@ -968,6 +971,11 @@ typedef struct system_status_var
    sent with prepared statement metadata.
   */
   ulong skip_metadata_count;
+  /* Number of PREPAREs that kept the already prepared statement */
+  ulong prepared_stmt_reused;
+  /* Text queries executed by/added to the per connection prepare cache */
+  ulong query_prepare_cache_hits;
+  ulong query_prepare_cache_misses;
 
   /*
     Number of statements sent from the client
@@ -1452,13 +1460,57 @@ class Statement_map
   */
   void close_transient_cursors();
   void erase(Statement *statement);
+  /*
+    Statements prepared internally for plain text queries, see
+    query_prepare_cache_size. They are looked up by the exact query text,
+    have no id or name visible to the client and are kept in LRU order.
+  */
+  Statement *find_text_query(const char *query, size_t length)
+  {
+    Statement *stmt;
+    stmt= (Statement *) my_hash_search(&text_query_hash, (uchar *) query,
+                                       length);
+    if (stmt)
+    {
+      /* Move to the most recently used end of the list */
+      stmt->unlink();
+      text_query_lru.push_back(stmt);
+    }
+    return stmt;
+  }
+  bool insert_text_query(Statement *statement, ulong max_count);
+  void erase_text_query(Statement *statement);
+  void trim_text_queries(ulong max_count);
+  /*
+    Remember a text query that is not cached yet.
+    Returns TRUE if the same text was noted before, i.e. the query is
+    repeated and worth preparing.
+  */
+  bool note_text_query(const char *query, size_t length)
+  {
+    my_hash_value_type hash_value=
+      my_calc_hash(&text_query_hash, (const uchar *) query, length);
+    my_hash_value_type *seen=
+      &text_query_seen[hash_value % array_elements(text_query_seen)];
+    if (*seen == hash_value)
+    {
+      *seen= 0;
+      return true;
+    }
+    *seen= hash_value;
+    return false;
+  }
   /* Erase all statements (calls Statement destructor) */
   void reset();
   ~Statement_map();
 private:
   HASH st_hash;
   HASH names_hash;
+  HASH text_query_hash;
   I_List<Statement> transient_cursor_list;
+  I_List<Statement> text_query_lru;
+  /* Hash values of text queries seen once, see note_text_query() */
+  my_hash_value_type text_query_seen[64];
   Statement *last_found_statement;
 };
 
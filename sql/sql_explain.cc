@@ -1883,6 +1883,13 @@ void Explain_table_access::print_explain_json(Explain_query *query,
         writer->add_double(jbuf_tracker.get_filtered_after_where()*100.0);
       else
         writer->add_null();
+      /*
+        Only print the number of refills when the buffer has overflowed,
+        as this is when the inner table had to be scanned more than once.
+      */
+      if (jbuf_refill_tracker.get_refills())
+        writer->add_member("r_buffer_refills").
+          add_ll(jbuf_refill_tracker.get_refills());
     }
   }
 
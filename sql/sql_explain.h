@@ -841,6 +841,7 @@ class Explain_table_access : public Sql_alloc
   Gap_time_tracker extra_time_tracker;
 
   Table_access_tracker jbuf_tracker;
+  Join_buffer_tracker jbuf_refill_tracker;
   
   Explain_rowid_filter *rowid_filter;
 
@@ -7976,10 +7976,34 @@ void mysql_parse(THD *thd, char *rawbuf, uint length,
   if (query_cache_send_result_to_client(thd, rawbuf, length) <= 0)
   {
     LEX *lex= thd->lex;
+    LEX_CSTRING query= { rawbuf, length };
+    Statement *prepared= find_prepared_text_query(thd, &query);
+    bool err= !prepared && parse_sql(thd, parser_state, NULL, true);
 
-    bool err= parse_sql(thd, parser_state, NULL, true);
-
-    if (likely(!err))
+    if (prepared)
+    {
+      /* The query was prepared by an earlier execution, don't parse it */
+      lex->sql_command= SQLCOM_SELECT;
+      thd->m_statement_psi=
+        MYSQL_REFINE_STATEMENT(thd->m_statement_psi,
+                               sql_statement_info[SQLCOM_SELECT].m_key);
+#ifndef NO_EMBEDDED_ACCESS_CHECKS
+      if (mqh_used && thd->user_connect && check_mqh(thd, SQLCOM_SELECT))
+        thd->net.error= 0;
+      else
+#endif
+      {
+        MYSQL_QUERY_EXEC_START(thd->query(),
+                               thd->thread_id,
+                               thd->get_db(),
+                               &thd->security_ctx->priv_user[0],
+                               (char *) thd->security_ctx->host_or_ip,
+                               0);
+        execute_prepared_text_query(thd, prepared);
+        MYSQL_QUERY_EXEC_DONE(thd->is_error());
+      }
+    }
+    else if (likely(!err))
     {
       thd->m_statement_psi=
         MYSQL_REFINE_STATEMENT(thd->m_statement_psi,
@@ -8025,7 +8049,10 @@ void mysql_parse(THD *thd, char *rawbuf, uint length,
                                  0);
 
           int error __attribute__((unused));
-          error= mysql_execute_command(thd);
+          if (!found_semicolon && prepare_and_execute_text_query(thd))
+            error= thd->is_error();
+          else
+            error= mysql_execute_command(thd);
           MYSQL_QUERY_EXEC_DONE(error);
 	}
       }
@@ -166,7 +166,9 @@ class Prepared_statement: public Statement
   enum flag_values
   {
     IS_IN_USE= 1,
-    IS_SQL_PREPARE= 2
+    IS_SQL_PREPARE= 2,
+    /* Prepared internally for a text query, see query_prepare_cache_size */
+    IS_TEXT_QUERY= 4
   };
 
   THD *thd;
@@ -207,7 +209,10 @@ class Prepared_statement: public Statement
   inline bool is_in_use() { return flags & (uint) IS_IN_USE; }
   inline bool is_sql_prepare() const { return flags & (uint) IS_SQL_PREPARE; }
   void set_sql_prepare() { flags|= (uint) IS_SQL_PREPARE; }
+  inline bool is_text_query() const { return flags & (uint) IS_TEXT_QUERY; }
+  void set_text_query() { flags|= (uint) (IS_TEXT_QUERY | IS_SQL_PREPARE); }
   bool prepare(const char *packet, uint packet_length);
+  bool is_same_prepare(const LEX_CSTRING *query) const;
   bool execute_loop(String *expanded_query,
                     bool open_cursor,
                     uchar *packet_arg, uchar *packet_end_arg);
@@ -227,6 +232,13 @@ class Prepared_statement: public Statement
   */
   MEM_ROOT main_mem_root;
   sql_mode_t m_sql_mode;
+  CHARSET_INFO *m_collation_connection;
+public:
+  /**
+    Digest of a text query, computed when it was parsed before prepare.
+    The token array is allocated with my_malloc() and owned by the statement.
+  */
+  sql_digest_storage m_text_digest;
 private:
   bool set_db(const LEX_CSTRING *db);
   bool set_parameters(String *expanded_query,
@@ -2952,19 +2964,11 @@ void mysql_sql_stmt_prepare(THD *thd)
   LEX_CSTRING query;
   DBUG_ENTER("mysql_sql_stmt_prepare");
 
-  if ((stmt= (Prepared_statement*) thd->stmt_map.find_by_name(name)))
+  if ((stmt= (Prepared_statement*) thd->stmt_map.find_by_name(name)) &&
+      stmt->is_in_use())
   {
-    /*
-      If there is a statement with the same name, remove it. It is ok to
-      remove old and fail to insert a new one at the same time.
-    */
-    if (stmt->is_in_use())
-    {
-      my_error(ER_PS_NO_RECURSION, MYF(0));
-      DBUG_VOID_RETURN;
-    }
-
-    stmt->deallocate();
+    my_error(ER_PS_NO_RECURSION, MYF(0));
+    DBUG_VOID_RETURN;
   }
 
   /*
@@ -2972,8 +2976,31 @@ void mysql_sql_stmt_prepare(THD *thd)
     See comments in get_dynamic_sql_string().
   */
   StringBuffer<256> buffer;
-  if (lex->prepared_stmt.get_dynamic_sql_string(thd, &query, &buffer) ||
-      ! (stmt= new Prepared_statement(thd)))
+  bool error= lex->prepared_stmt.get_dynamic_sql_string(thd, &query, &buffer);
+
+  if (stmt)
+  {
+    if (!error && thd->variables.prepared_stmt_reuse &&
+        stmt->is_same_prepare(&query))
+    {
+      /*
+        The statement is prepared already. Should any of its tables
+        change, it will be re-prepared by the Reprepare_observer on
+        EXECUTE.
+      */
+      status_var_increment(thd->status_var.prepared_stmt_reused);
+      thd->session_tracker.state_change.mark_as_changed(thd);
+      my_ok(thd, 0L, 0L, "Statement prepared");
+      DBUG_VOID_RETURN;
+    }
+    /*
+      If there is a statement with the same name, remove it. It is ok to
+      remove old and fail to insert a new one at the same time.
+    */
+    stmt->deallocate();
+  }
+
+  if (error || ! (stmt= new Prepared_statement(thd)))
   {
     DBUG_VOID_RETURN;                           /* out of memory */
   }
@@ -3694,6 +3721,190 @@ void mysql_sql_stmt_execute(THD *thd)
 }
 
 
+/**
+  Look up the statement prepared by an earlier execution of a text query.
+
+    Plain SELECT queries are kept prepared per connection when
+    query_prepare_cache_size is not 0, so that executing the same query
+    text again doesn't need to parse it. The statement is used only if the
+    character set, SQL mode and current database are those it was
+    prepared with; should any of its tables change, it is re-prepared by
+    the Reprepare_observer like any other prepared statement.
+
+  @param thd                thread handle
+  @param query              text of the query
+
+  @return
+    the statement to run with execute_prepared_text_query(), or NULL if
+    the query has to be parsed
+*/
+
+Statement *find_prepared_text_query(THD *thd, const LEX_CSTRING *query)
+{
+  Prepared_statement *stmt;
+
+  if (likely(!thd->variables.query_prepare_cache_size))
+  {
+    /* The cache may have been disabled after statements were added */
+    thd->stmt_map.trim_text_queries(0);
+    return NULL;
+  }
+  if (thd->slave_thread ||
+      !(stmt= (Prepared_statement*)
+        thd->stmt_map.find_text_query(query->str, query->length)))
+    return NULL;
+
+  if (!stmt->is_same_prepare(query))
+  {
+    thd->stmt_map.erase_text_query(stmt);
+    return NULL;
+  }
+
+  if (thd->m_digest)
+  {
+    /* Report the digest that parse_sql() would have computed */
+    PSI_digest_locker *locker= MYSQL_DIGEST_START(thd->m_statement_psi);
+    if (locker)
+    {
+      if (stmt->m_text_digest.is_empty())
+      {
+        /* Digests were not collected when the query was prepared */
+        thd->stmt_map.erase_text_query(stmt);
+        return NULL;
+      }
+      thd->m_digest->m_digest_storage.copy(&stmt->m_text_digest);
+      MYSQL_DIGEST_END(locker, &thd->m_digest->m_digest_storage);
+    }
+  }
+  return stmt;
+}
+
+
+/**
+  Execute a statement prepared for a text query and send the result to
+  the client using text protocol.
+
+    The Items created while parsing the text query, if any, are hidden
+    from the statement, just as mysql_sql_stmt_execute() does for the
+    "external" Items of EXECUTE.
+*/
+
+static void execute_text_query(THD *thd, Prepared_statement *stmt)
+{
+  CSET_STRING orig_query= thd->query_string;
+  /* Query text for binary, general or slow log, if any of them is open */
+  String expanded_query;
+  Item *free_list_backup= thd->free_list;
+  thd->free_list= NULL;
+
+  Item_change_list_savepoint change_list_savepoint(thd);
+  (void) stmt->execute_loop(&expanded_query, FALSE, NULL, NULL);
+  change_list_savepoint.rollback(thd);
+  thd->free_items();
+  thd->free_list= free_list_backup;
+
+  stmt->lex->restore_set_statement_var();
+  /* The statement text may be freed before the query is logged */
+  thd->set_query(orig_query);
+}
+
+
+void execute_prepared_text_query(THD *thd, Statement *stmt)
+{
+  DBUG_ENTER("execute_prepared_text_query");
+  status_var_increment(thd->status_var.query_prepare_cache_hits);
+  execute_text_query(thd, (Prepared_statement*) stmt);
+  DBUG_VOID_RETURN;
+}
+
+
+/**
+  Prepare a parsed text query, add it to the connection's prepared query
+  cache and execute it, see find_prepared_text_query().
+
+    Only single SELECT statements that don't use stored routines and
+    don't return warnings on parse are cached. Preparing parses the query
+    a second time, so a query is prepared only when its text is seen
+    again: a query that is never repeated costs just a hash of its text.
+    The parse tree in thd->lex is left alone: it is used to run the query
+    directly if it is not prepared.
+
+  @param thd                thread handle
+
+  @retval
+    FALSE  the query was not cached and has to be executed by the caller
+  @retval
+    TRUE   the query was executed or an error was set in THD
+*/
+
+bool prepare_and_execute_text_query(THD *thd)
+{
+  LEX *lex= thd->lex;
+  ulong max_count= thd->variables.query_prepare_cache_size;
+  CSET_STRING orig_query= thd->query_string;
+  Prepared_statement *stmt;
+  DBUG_ENTER("prepare_and_execute_text_query");
+
+  if (likely(!max_count) || thd->slave_thread ||
+      lex->sql_command != SQLCOM_SELECT || lex->describe ||
+      lex->analyze_stmt || lex->result || lex->sphead ||
+      !lex->stmt_var_list.is_empty() || lex->uses_stored_routines() ||
+      lex->proc_list.elements ||
+      thd->get_stmt_da()->current_statement_warn_count() ||
+      !thd->stmt_map.note_text_query(orig_query.str(), orig_query.length()))
+    DBUG_RETURN(FALSE);
+
+  if (!(stmt= new Prepared_statement(thd)))
+    DBUG_RETURN(FALSE);
+  stmt->set_text_query();
+
+  /* Prepared_statement::prepare() frees thd->free_list on cleanup */
+  Item *free_list_backup= thd->free_list;
+  thd->free_list= NULL;
+  bool error= stmt->prepare(orig_query.str(), orig_query.length());
+  thd->set_query(orig_query);
+  thd->free_list= free_list_backup;
+
+  if (error || stmt->param_count)
+  {
+    delete stmt;
+    if (error && thd->get_stmt_da()->sql_errno() != ER_UNSUPPORTED_PS)
+      DBUG_RETURN(TRUE);
+    /* Not supported in a prepared statement, run it directly */
+    thd->clear_error();
+    thd->get_stmt_da()->clear_warning_info(thd->query_id);
+    DBUG_RETURN(FALSE);
+  }
+  /* Warnings of the prepare are returned again on execution */
+  thd->get_stmt_da()->clear_warning_info(thd->query_id);
+
+  if (thd->m_digest && !thd->m_digest->m_digest_storage.is_empty())
+  {
+    const sql_digest_storage *digest= &thd->m_digest->m_digest_storage;
+    /*
+      Not on stmt->mem_root: reprepare() replaces that root and frees the
+      old one, and the digest must outlive it.
+    */
+    uchar *token_array= (uchar*) my_malloc(PSI_INSTRUMENT_ME,
+                                           digest->m_byte_count, MYF(0));
+    if (token_array)
+    {
+      stmt->m_text_digest.reset(token_array, digest->m_byte_count);
+      stmt->m_text_digest.copy(digest);
+    }
+  }
+
+  if (thd->stmt_map.insert_text_query(stmt, max_count))
+  {
+    delete stmt;
+    DBUG_RETURN(FALSE);
+  }
+  status_var_increment(thd->status_var.query_prepare_cache_misses);
+  execute_text_query(thd, stmt);
+  DBUG_RETURN(TRUE);
+}
+
+
 /**
   COM_STMT_FETCH handler: fetches requested amount of rows from cursor.
 
@@ -4111,7 +4322,8 @@ Prepared_statement::Prepared_statement(THD *thd_arg)
   iterations(0),
   start_param(0),
   read_types(0),
-  m_sql_mode(thd->variables.sql_mode)
+  m_sql_mode(thd->variables.sql_mode),
+  m_collation_connection(thd->variables.collation_connection)
 {
   init_sql_alloc(key_memory_prepared_statement_main_mem_root,
                  &main_mem_root, thd_arg->variables.query_alloc_block_size,
@@ -4197,6 +4409,7 @@ Prepared_statement::~Prepared_statement()
     delete (st_lex_local *) lex;
   }
   free_root(&main_mem_root, MYF(0));
+  my_free(m_text_digest.m_token_array);
   DBUG_VOID_RETURN;
 }
 
@@ -4294,9 +4507,11 @@ bool Prepared_statement::prepare(const char *packet, uint packet_len)
   /*
     If this is an SQLCOM_PREPARE, we also increase Com_prepare_sql.
     However, it seems handy if com_stmt_prepare is increased always,
-    no matter what kind of prepare is processed.
+    no matter what kind of prepare is processed. Statements prepared
+    for the text query cache are accounted as the queries they run.
   */
-  status_var_increment(thd->status_var.com_stmt_prepare);
+  if (!is_text_query())
+    status_var_increment(thd->status_var.com_stmt_prepare);
 
   if (! (lex= new (mem_root) st_lex_local))
     DBUG_RETURN(TRUE);
@@ -4485,7 +4700,7 @@ bool Prepared_statement::prepare(const char *packet, uint packet_len)
       sub-statements inside stored procedures are not logged into
       the general log.
     */
-    if (thd->spcont == NULL)
+    if (thd->spcont == NULL && !is_text_query())
       general_log_write(thd, COM_STMT_PREPARE, query(), query_length());
   }
   DBUG_RETURN(error);
@@ -4905,6 +5120,7 @@ Prepared_statement::reprepare()
   copy.m_sql_mode= m_sql_mode;
 
   copy.set_sql_prepare(); /* To suppress sending metadata to the client. */
+  copy.flags|= flags & (uint) IS_TEXT_QUERY;
 
   status_var_increment(thd->status_var.com_stmt_reprepare);
 
@@ -5075,7 +5291,8 @@ bool Prepared_statement::execute(String *expanded_query, bool open_cursor)
 
   LEX_CSTRING stmt_db_name= db;
 
-  status_var_increment(thd->status_var.com_stmt_execute);
+  if (!is_text_query())
+    status_var_increment(thd->status_var.com_stmt_execute);
 
   if (flags & (uint) IS_IN_USE)
   {
@@ -5174,7 +5391,7 @@ bool Prepared_statement::execute(String *expanded_query, bool open_cursor)
     the general log.
   */
 
-  if (thd->spcont == nullptr)
+  if (thd->spcont == nullptr && !is_text_query())
     general_log_write(thd, COM_STMT_EXECUTE, thd->query(), thd->query_length());
 
   if (open_cursor)
@@ -5256,8 +5473,12 @@ bool Prepared_statement::execute(String *expanded_query, bool open_cursor)
     slow_query_log is restored to its original value by the time the function
     log_slow_statement is called from disptach_command() to write a record
     into slow query log.
+
+    A text query can't have a SET STATEMENT clause and is logged by
+    dispatch_command() like any other query.
   */
-  log_slow_statement(thd);
+  if (!is_text_query())
+    log_slow_statement(thd);
 
   lex->restore_set_statement_var();
 
@@ -5348,6 +5569,27 @@ bool Prepared_statement::execute_immediate(const char *query, uint query_len)
 }
 
 
+/**
+  Check whether a repeated PREPARE of this statement would produce the
+  same statement, i.e. whether the statement text and everything that
+  affects its parsing are unchanged.
+
+  @param query  the statement text of the new PREPARE
+*/
+
+bool Prepared_statement::is_same_prepare(const LEX_CSTRING *query) const
+{
+  return state != Query_arena::STMT_ERROR &&
+         query->length == query_length() &&
+         !memcmp(query->str, this->query(), query->length) &&
+         query_charset() == thd->charset() &&
+         m_sql_mode == thd->variables.sql_mode &&
+         m_collation_connection == thd->variables.collation_connection &&
+         db.length == thd->db.length &&
+         (!db.length || !memcmp(db.str, thd->db.str, db.length));
+}
+
+
 /**
   Common part of DEALLOCATE PREPARE, EXECUTE IMMEDIATE, mysqld_stmt_close.
 */
@@ -23,6 +23,7 @@
 #define STMT_ID_MASK 0x7FFFFFFF
 
 class THD;
+class Statement;
 struct LEX;
 
 /**
@@ -79,6 +80,9 @@ void mysql_sql_stmt_prepare(THD *thd);
 void mysql_sql_stmt_execute(THD *thd);
 void mysql_sql_stmt_execute_immediate(THD *thd);
 void mysql_sql_stmt_close(THD *thd);
+Statement *find_prepared_text_query(THD *thd, const LEX_CSTRING *query);
+void execute_prepared_text_query(THD *thd, Statement *stmt);
+bool prepare_and_execute_text_query(THD *thd);
 void mysqld_stmt_fetch(THD *thd, char *packet, uint packet_length);
 void mysqld_stmt_reset(THD *thd, char *packet);
 void mysql_stmt_get_longdata(THD *thd, char *pos, ulong packet_length);
@@ -20854,6 +20854,7 @@ sub_select_cache(JOIN *join, JOIN_TAB *join_tab, bool end_of_records)
       won't add any more records. Now try to find all the matching 
       extensions for all records in the buffer.
     */ 
+    join_tab->jbuf_refill_tracker->on_buffer_full();
     rc= cache->join_records(FALSE);
     DBUG_RETURN(rc);
   }
@@ -26984,6 +26985,7 @@ bool JOIN_TAB::save_explain_data(Explain_table_access *eta,
   // psergey-todo: data for filtering!
   tracker= &eta->tracker;
   jbuf_tracker= &eta->jbuf_tracker;
+  jbuf_refill_tracker= &eta->jbuf_refill_tracker;
 
   /* Enable the table access time tracker only for "ANALYZE stmt" */
   if (thd->lex->analyze_stmt)
@@ -561,6 +561,10 @@ class Sort_param {
   ha_rows *accepted_rows;         /* For ROWNUM */
   bool using_pq;
   bool set_all_read_bits;
+  uint sort_threads;              // @@sort_threads
+  uint sort_threads_used;         // Max threads that sorted or merged
+  THD *merge_thd;                 // Query thread, while merge workers run
+  bool allow_topn_filter;         // May push a top-N filter to the engine
 
   uchar *unique_buff;
   bool not_killable;
@@ -2851,6 +2851,14 @@ static Sys_var_ulong Sys_preload_buff_size(
        SESSION_VAR(preload_buff_size), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(1024, 1024*1024*1024), DEFAULT(32768), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_prepared_stmt_reuse(
+       "prepared_stmt_reuse",
+       "When PREPARE is repeated for a statement name with the same "
+       "statement text, character set, SQL mode and current database, keep "
+       "the prepared statement instead of preparing it again. Changed tables "
+       "are detected at EXECUTE",
+       SESSION_VAR(prepared_stmt_reuse), CMD_LINE(OPT_ARG), DEFAULT(FALSE));
+
 static Sys_var_uint Sys_protocol_version(
        "protocol_version",
        "The version of the client/server protocol used by the MariaDB server",
@@ -3012,6 +3020,17 @@ static Sys_var_ulong Sys_query_alloc_block_size(
        BLOCK_SIZE(1024), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
        ON_UPDATE(fix_thd_mem_root));
 
+static Sys_var_ulong Sys_query_prepare_cache_size(
+       "query_prepare_cache_size",
+       "Number of plain SELECT statements per connection that are kept "
+       "prepared. A query is prepared when the same text is executed the "
+       "second time, which parses it once more; later executions with the "
+       "same text, character set, SQL mode and current database are not "
+       "parsed. Queries that differ in literals are different queries. "
+       "0 disables the cache",
+       SESSION_VAR(query_prepare_cache_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, 1024), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_query_prealloc_size(
        "query_prealloc_size",
        "Persistent buffer for query parsing and execution",
@@ -3624,6 +3643,16 @@ static Sys_var_ulonglong Sys_sort_buffer(
        VALID_RANGE(MIN_SORT_MEMORY, SIZE_T_MAX), DEFAULT(MAX_SORT_MEMORY),
        BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_sort_threads(
+       "sort_threads",
+       "Number of threads that sort the keys of one sort buffer, and that "
+       "merge the sorted runs of one sort on disk. Large buffers are split "
+       "into this many chunks, which are sorted and merged in parallel. "
+       "The threads come from a server-wide pool that runs at most one "
+       "thread per CPU. 1 disables parallel sorting.",
+       SESSION_VAR(sort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
 export sql_mode_t expand_sql_mode(sql_mode_t sql_mode)
 {
   if (sql_mode & MODE_ANSI)
@@ -4066,6 +4095,16 @@ Sys_threadpool_dedicated_listener(
   GLOBAL_VAR(threadpool_dedicated_listener), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
   NO_MUTEX_GUARD, NOT_IN_BINLOG
 );
+
+static Sys_var_on_access_global<Sys_var_mybool,
+                                PRIV_SET_SYSTEM_GLOBAL_VAR_THREAD_POOL>
+Sys_threadpool_work_stealing(
+  "thread_pool_work_stealing",
+  "If set to 1, a worker thread that has nothing to do in its own group "
+  "takes over a queued connection from a group whose workers are all busy",
+  GLOBAL_VAR(threadpool_work_stealing), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
+  NO_MUTEX_GUARD, NOT_IN_BINLOG
+);
 #endif /* HAVE_POOL_OF_THREADS */
 
 /**
@@ -480,6 +480,64 @@ static bool is_queue_empty(thread_group_t *thread_group)
 }
 
 
+/**
+  Take over a queued connection from another group (thread_pool_work_stealing).
+
+  Only groups that have queued work and no waiting worker threads are
+  considered, since those would otherwise wake up a worker of their own.
+  The connection is moved to the stealing group for good, like in
+  change_group(), so that subsequent events are handled there.
+
+  To avoid deadlocks, the mutex of the other group is only tried.
+
+  @param thread_group - group of the current worker, its mutex is locked
+
+  @return connection with pending event, or NULL
+*/
+
+static TP_connection_generic *queue_steal(thread_group_t *thread_group)
+{
+  mysql_mutex_assert_owner(&thread_group->mutex);
+  const uint group_id= (uint) (thread_group - all_groups);
+
+  for (uint i= 1; i < group_count; i++)
+  {
+    thread_group_t *victim= &all_groups[(group_id + i) % group_count];
+
+    /* Dirty read, rechecked below */
+    if (is_queue_empty(victim) || !victim->waiting_threads.is_empty())
+      continue;
+
+    if (mysql_mutex_trylock(&victim->mutex))
+      continue;
+
+    TP_connection_generic *c= NULL;
+    if (!victim->shutdown && victim->waiting_threads.is_empty())
+      c= queue_get(victim);
+
+    if (c)
+    {
+      if (c->bound_to_poll_descriptor)
+      {
+        io_poll_disassociate_fd(victim->pollfd, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      victim->connection_count--;
+    }
+    mysql_mutex_unlock(&victim->mutex);
+
+    if (c)
+    {
+      c->thread_group= thread_group;
+      thread_group->connection_count++;
+      TP_INCREMENT_GROUP_COUNTER(thread_group, steals);
+      return c;
+    }
+  }
+  return NULL;
+}
+
+
 static void queue_init(thread_group_t *thread_group)
 {
   for (int i=0; i < NQUEUES; i++)
@@ -1219,6 +1277,14 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Before going to sleep, look for work queued in busy groups. */
+    if (!oversubscribed && threadpool_work_stealing)
+    {
+      connection= queue_steal(thread_group);
+      if (connection)
+        break;
+    }
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -126,6 +126,7 @@ struct thread_group_counters_t
   ulonglong stalls;
   ulonglong dequeues[2];
   ulonglong polls[2];
+  ulonglong steals;
 };
 
 struct thread_group_t
@@ -72,7 +72,7 @@ static handler *heap_create_handler(handlerton *hton,
 
 ha_heap::ha_heap(handlerton *hton, TABLE_SHARE *table_arg)
   :handler(hton, table_arg), file(0), records_changed(0), key_stat_version(0), 
-  internal_table(0)
+  internal_table(0), scan_copy(0), scan_copy_parts(0)
 {}
 
 /*
@@ -340,15 +340,93 @@ int ha_heap::index_last(uchar * buf)
 
 int ha_heap::rnd_init(bool scan)
 {
-  return scan ? heap_scan_init(file) : 0;
+  if (!scan)
+    return 0;
+  setup_scan_copy();
+  return heap_scan_init(file);
 }
 
 int ha_heap::rnd_next(uchar *buf)
 {
-  int error=heap_scan(file, buf);
+  if (!scan_copy_parts)
+    return heap_scan(file, buf);
+
+  int error= heap_scan_next(file);
+  if (!error)
+  {
+    for (uint i= 0; i < scan_copy_parts; i+= 2)
+      memcpy(buf + scan_copy[i], file->current_ptr + scan_copy[i],
+             scan_copy[i + 1] - scan_copy[i]);
+  }
   return error;
 }
 
+/*
+  Decide which parts of the record a table scan has to copy
+
+  DESCRIPTION
+    Rows are stored in the same format as table->record[0], so copying
+    them is the main cost of scanning a wide table. When the statement
+    only reads the table, copy just the null bits and the columns in
+    read_set, merging adjacent ones; unread columns are left alone.
+    Statements that can update or delete rows need the whole record,
+    as heap_update() and heap_delete() compare it with the stored one.
+*/
+
+void ha_heap::setup_scan_copy()
+{
+  scan_copy_parts= 0;
+  if (get_lock_type() != F_RDLCK || table->s->tmp_table != NO_TMP_TABLE ||
+      bitmap_is_set_all(table->read_set))
+    return;
+
+  if (!scan_copy &&
+      !(scan_copy= (uint*) alloc_root(&table->mem_root,
+                                      sizeof(uint) * 2 *
+                                      (table->s->fields + 1))))
+    return;
+
+  uint parts= 0, copied= 0;
+  uint start= 0, end= table->s->null_bytes;
+  for (Field **field= table->field; *field; field++)
+  {
+    if (!bitmap_is_set(table->read_set, (*field)->field_index))
+      continue;
+    uint field_start= (uint) (*field)->offset(table->record[0]);
+    uint field_end= field_start + (*field)->pack_length_in_rec();
+    if (field_start < start)
+      return;                                   // Unexpected layout
+    if (field_start > end)
+    {
+      if (end > start)
+      {
+        scan_copy[parts++]= start;
+        scan_copy[parts++]= end;
+        copied+= end - start;
+      }
+      start= field_start;
+    }
+    set_if_bigger(end, field_end);
+  }
+  if (end > start)
+  {
+    scan_copy[parts++]= start;
+    scan_copy[parts++]= end;
+    copied+= end - start;
+  }
+
+  /* Not worth it if most of the record is copied anyway */
+  if (copied * 4 < table->s->reclength * 3)
+    scan_copy_parts= parts;
+}
+
+void ha_heap::column_bitmaps_signal()
+{
+  handler::column_bitmaps_signal();
+  if (inited == RND)
+    setup_scan_copy();
+}
+
 int ha_heap::rnd_pos(uchar * buf, uchar *pos)
 {
   int error;
@@ -34,6 +34,12 @@ class ha_heap final : public handler
   ulong   records_changed;
   uint    key_stat_version;
   my_bool internal_table;
+  /*
+    Byte ranges of the record, as pairs of start and end offsets, that
+    rnd_next() copies in a read-only scan; see setup_scan_copy()
+  */
+  uint    *scan_copy;
+  uint    scan_copy_parts;
 public:
   ha_heap(handlerton *hton, TABLE_SHARE *table);
   ~ha_heap() {}
@@ -94,6 +100,7 @@ class ha_heap final : public handler
   int rnd_next(uchar *buf);
   int rnd_pos(uchar * buf, uchar *pos);
   void position(const uchar *record);
+  void column_bitmaps_signal();
   int can_continue_handler_scan();
   int info(uint);
   int extra(enum ha_extra_function operation);
@@ -122,4 +129,5 @@ class ha_heap final : public handler
   int find_unique_row(uchar *record, uint unique_idx);
 private:
   void update_key_stats();
+  void setup_scan_copy();
 };
@@ -37,11 +37,17 @@ int heap_scan_init(register HP_INFO *info)
   DBUG_RETURN(0);
 }
 
-int heap_scan(register HP_INFO *info, uchar *record)
+/*
+  Position the scan on the next record without copying it.
+  Returns the same values as heap_scan(); on success the record
+  is at info->current_ptr.
+*/
+
+int heap_scan_next(register HP_INFO *info)
 {
   HP_SHARE *share=info->s;
   ulong pos;
-  DBUG_ENTER("heap_scan");
+  DBUG_ENTER("heap_scan_next");
 
   pos= ++info->current_record;
   if (pos < info->next_block)
@@ -71,7 +77,16 @@ int heap_scan(register HP_INFO *info, uchar *record)
     DBUG_RETURN(my_errno=HA_ERR_RECORD_DELETED);
   }
   info->update= HA_STATE_PREV_FOUND | HA_STATE_NEXT_FOUND | HA_STATE_AKTIV;
-  memcpy(record,info->current_ptr,(size_t) share->reclength);
   info->current_hash_ptr=0;			/* Can't use read_next */
   DBUG_RETURN(0);
+} /* heap_scan_next */
+
+
+int heap_scan(register HP_INFO *info, uchar *record)
+{
+  int error;
+  DBUG_ENTER("heap_scan");
+  if (!(error= heap_scan_next(info)))
+    memcpy(record,info->current_ptr,(size_t) info->s->reclength);
+  DBUG_RETURN(error);
 } /* heap_scan */
@@ -28,6 +28,7 @@ Created 2/23/1996 Heikki Tuuri
 #include "ut0byte.h"
 #include "rem0cmp.h"
 #include "trx0trx.h"
+#include "buf0rea.h"
 
 /**************************************************************//**
 Allocates memory for a persistent cursor object and initializes the cursor.
@@ -514,6 +515,19 @@ btr_pcur_move_to_next_page(
 
 	btr_leaf_page_release(btr_pcur_get_block(cursor), mode, mtr);
 
+	if (srv_leaf_read_ahead && page_is_leaf(next_page)) {
+		/* Start reading the leaf page after next_page, so that
+		the read is in progress while we process next_page. */
+		const uint32_t ahead_page_no = btr_page_get_next(next_page);
+
+		if (ahead_page_no != FIL_NULL) {
+			buf_read_ahead_leaf(
+				page_id_t(next_block->page.id().space(),
+					  ahead_page_no),
+				next_block->zip_size());
+		}
+	}
+
 	page_cur_set_before_first(next_block, btr_pcur_get_page_cur(cursor));
 
 	ut_d(page_check_dir(next_page));
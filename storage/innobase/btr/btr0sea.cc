@@ -717,42 +717,55 @@ btr_search_update_hash_ref(
 	ut_ad(block->page.id().space() == index->table->space_id);
 	ut_ad(index == cursor->index);
 	ut_ad(!dict_index_is_ibuf(index));
+
+	const rec_t* rec = btr_cur_get_rec(cursor);
+
+	if (!page_rec_is_user_rec(rec)) {
+		return;
+	}
+
+	/* Compute the fold before acquiring the exclusive latch, which
+	would block all hash lookups in this partition meanwhile. The
+	record is protected by the page latch; whether the prefix that
+	the fold was computed on is still the one that the page is hashed
+	on is checked below. */
+	const uint16_t n_fields = info->n_fields;
+	const uint16_t n_bytes = info->n_bytes;
+	const bool left_side = info->left_side;
+
+	if (block->curr_n_fields != n_fields
+	    || block->curr_n_bytes != n_bytes
+	    || block->curr_left_side != left_side) {
+		return;
+	}
+
+	mem_heap_t*	heap		= NULL;
+	rec_offs	offsets_[REC_OFFS_NORMAL_SIZE];
+	rec_offs_init(offsets_);
+
+	const ulint fold = rec_fold(
+		rec,
+		rec_get_offsets(rec, index, offsets_, index->n_core_fields,
+				ULINT_UNDEFINED, &heap),
+		n_fields, n_bytes, index->id);
+	if (UNIV_LIKELY_NULL(heap)) {
+		mem_heap_free(heap);
+	}
+
 	auto part = btr_search_sys.get_part(*index);
 	part->latch.wr_lock(SRW_LOCK_CALL);
 	ut_ad(!block->index || block->index == index);
 
 	if (block->index
-	    && (block->curr_n_fields == info->n_fields)
-	    && (block->curr_n_bytes == info->n_bytes)
-	    && (block->curr_left_side == info->left_side)
+	    && (block->curr_n_fields == n_fields)
+	    && (block->curr_n_bytes == n_bytes)
+	    && (block->curr_left_side == left_side)
 	    && btr_search_enabled) {
-		mem_heap_t*	heap		= NULL;
-		rec_offs	offsets_[REC_OFFS_NORMAL_SIZE];
-		rec_offs_init(offsets_);
-
-		const rec_t* rec = btr_cur_get_rec(cursor);
-
-		if (!page_rec_is_user_rec(rec)) {
-			goto func_exit;
-		}
-
-		ulint fold = rec_fold(
-			rec,
-			rec_get_offsets(rec, index, offsets_,
-					index->n_core_fields,
-					ULINT_UNDEFINED, &heap),
-			block->curr_n_fields,
-			block->curr_n_bytes, index->id);
-		if (UNIV_LIKELY_NULL(heap)) {
-			mem_heap_free(heap);
-		}
-
 		ha_insert_for_fold(&part->table, part->heap, fold, block, rec);
 
 		MONITOR_INC(MONITOR_ADAPTIVE_HASH_ROW_ADDED);
 	}
 
-func_exit:
 	part->latch.wr_unlock();
 }
 
@@ -1110,9 +1123,7 @@ btr_search_guess_on_hash(
 
 		buf_block_buf_fix_inc(block);
 		hash_lock->read_unlock();
-		block->page.set_accessed();
 
-		buf_page_make_young_if_needed(&block->page);
 		mtr_memo_type_t	fix_type;
 		if (latch_mode == BTR_SEARCH_LEAF) {
 			if (!block->lock.s_lock_try()) {
@@ -1129,10 +1140,15 @@ btr_search_guess_on_hash(
 		}
 		mtr->memo_push(block, fix_type);
 
-		++buf_pool.stat.n_page_gets;
-
+		/* The block is now buffer-fixed and latched. Release the
+		adaptive hash index latch before touching the LRU list,
+		which may require buf_pool.mutex. */
 		part->latch.rd_unlock();
 
+		block->page.set_accessed();
+		buf_page_make_young_if_needed(&block->page);
+		++buf_pool.stat.n_page_gets;
+
 		if (UNIV_UNLIKELY(fail)) {
 			goto fail_and_release_page;
 		}
@@ -2802,10 +2802,10 @@ buf_page_get_low(
 		or relocated while we are attempting to allocate an
 		uncompressed page. */
 
-		block = buf_LRU_get_free_block(false);
+		mysql_mutex_lock(&buf_pool.mutex);
+		block = buf_LRU_get_free_block(true);
 		buf_block_init_low(block);
 
-		mysql_mutex_lock(&buf_pool.mutex);
 		hash_lock = buf_pool.page_hash.lock_get(fold);
 
 		hash_lock->write_lock();
@@ -4168,6 +4168,9 @@ void buf_stats_get_pool_info(buf_pool_info_t *pool_info)
 
 	pool_info->n_pending_flush_list = buf_pool.n_flush_list_;
 
+	pool_info->n_LRU_worker_batches = buf_flush_LRU_worker_batches;
+	pool_info->n_LRU_worker_pages = buf_flush_LRU_worker_pages;
+
 	current_time = time(NULL);
 	time_elapsed = 0.001 + difftime(current_time,
 					buf_pool.last_printout_time);
@@ -4295,6 +4298,14 @@ buf_print_io_instance(
 		pool_info->n_pending_flush_lru,
 		pool_info->n_pending_flush_list);
 
+	if (innodb_lru_flush_worker) {
+		fprintf(file,
+			"LRU flush worker: " ULINTPF " batches, "
+			ULINTPF " pages flushed\n",
+			pool_info->n_LRU_worker_batches,
+			pool_info->n_LRU_worker_pages);
+	}
+
 	fprintf(file,
 		"Pages made young " ULINTPF ", not young " ULINTPF "\n"
 		"%.2f youngs/s, %.2f non-youngs/s\n"
@@ -41,6 +41,8 @@ Created April 08, 2011 Vasil Dimov
 #include "ut0byte.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 
 #include "mysql/service_wsrep.h" /* wsrep_recovery */
 #include <my_service_manager.h>
@@ -61,6 +63,9 @@ static volatile bool	buf_load_should_start;
 
 static bool	buf_load_abort_flag;
 
+/** Whether buf_load() is being executed */
+static std::atomic<bool>	buf_load_running;
+
 /** Start the buffer pool dump/load task and instructs it to start a dump. */
 void buf_dump_start()
 {
@@ -768,7 +773,9 @@ static void buf_dump_load_func(void *)
 #ifdef WITH_WSREP
 		if (!get_wsrep_recovery()) {
 #endif /* WITH_WSREP */
+			buf_load_running = true;
 			buf_load();
+			buf_load_running = false;
 #ifdef WITH_WSREP
 		}
 #endif /* WITH_WSREP */
@@ -782,7 +789,9 @@ static void buf_dump_load_func(void *)
 		}
 		if (buf_load_should_start) {
 			buf_load_should_start = false;
+			buf_load_running = true;
 			buf_load();
+			buf_load_running = false;
 		}
 
 		if (!buf_dump_should_start && !buf_load_should_start) {
@@ -811,12 +820,54 @@ static tpool::task_group tpool_group(1);
 static tpool::waitable_task buf_dump_load_task(buf_dump_load_func, &tpool_group);
 static bool load_dump_enabled;
 
+/** Timer for innodb_buffer_pool_dump_interval */
+static std::unique_ptr<tpool::timer> buf_dump_timer;
+/** Protects buf_dump_timer */
+static std::mutex buf_dump_timer_mutex;
+
+/** Periodic buffer pool dump, so that a restart after a crash
+can load a recent copy of innodb_buffer_pool_filename. */
+static void buf_dump_timer_callback(void *)
+{
+  /* During shutdown, the dump is controlled by
+  innodb_buffer_pool_dump_at_shutdown. */
+  if (SHUTTING_DOWN())
+    return;
+  /* Do not replace the file with a partially loaded buffer pool while
+  it is being loaded. After an aborted or failed load, the periodic
+  dump continues. */
+  if (buf_load_running || buf_load_should_start)
+    buf_dump_status(STATUS_INFO, "Periodic buffer pool dump skipped"
+                    " while the buffer pool is being loaded");
+  else
+    buf_dump_start();
+}
+
+/** Start, stop or reschedule the periodic buffer pool dump
+after innodb_buffer_pool_dump_interval was changed. */
+void buf_dump_interval_update()
+{
+  std::lock_guard<std::mutex> lk(buf_dump_timer_mutex);
+  if (!load_dump_enabled || SHUTTING_DOWN())
+    return;
+  if (const int period= srv_buf_pool_dump_interval * 1000)
+  {
+    if (!buf_dump_timer)
+      buf_dump_timer.reset(srv_thread_pool->create_timer
+                           (buf_dump_timer_callback));
+    buf_dump_timer->set_time(period, period);
+  }
+  else
+    buf_dump_timer.reset();
+}
+
 /** Start async buffer pool load, if srv_buffer_pool_load_at_startup was set.*/
 void buf_load_at_startup()
 {
   load_dump_enabled= true;
   if (srv_buffer_pool_load_at_startup)
     buf_do_load_dump();
+  buf_dump_interval_update();
 }
 
 static void buf_do_load_dump()
@@ -829,5 +880,9 @@ static void buf_do_load_dump()
 void buf_load_dump_end()
 {
   ut_ad(SHUTTING_DOWN());
+  {
+    std::lock_guard<std::mutex> lk(buf_dump_timer_mutex);
+    buf_dump_timer.reset();
+  }
   buf_dump_load_task.wait();
 }
@@ -56,6 +56,23 @@ ulint buf_lru_freed_page_count;
 /** Number of pages flushed. Protected by buf_pool.mutex. */
 ulint buf_flush_page_count;
 
+/** Number of batches run by the LRU flush worker.
+Protected by buf_pool.mutex. */
+ulint buf_flush_LRU_worker_batches;
+
+/** Number of pages flushed by the LRU flush worker.
+Protected by buf_pool.mutex. Also included in buf_lru_flush_page_count. */
+ulint buf_flush_LRU_worker_pages;
+
+/** Whether buf_flush_LRU_worker_task has been submitted and has not
+finished yet. Protected by buf_pool.mutex. */
+static bool buf_flush_LRU_worker_active;
+
+/** Whether buf_flush_LRU_worker_wake() may submit buf_flush_LRU_worker_task;
+cleared before the page cleaner disables the task on shutdown.
+Protected by buf_pool.mutex. */
+static bool buf_flush_LRU_worker_enabled;
+
 /** Flag indicating if the page_cleaner is in active state. */
 Atomic_relaxed<bool> buf_page_cleaner_is_active;
 
@@ -1267,6 +1284,12 @@ static void buf_flush_LRU_list_batch(ulint max, flush_counters_t *n)
     const lsn_t oldest_modification= bpage->oldest_modification();
     buf_pool.lru_hp.set(prev);
 
+    if (buf_LRU_second_chance(bpage))
+    {
+      bpage= buf_pool.lru_hp.get();
+      continue;
+    }
+
     if (oldest_modification <= 1 && bpage->can_relocate())
     {
       /* block is ready for eviction i.e., it is clean and is not
@@ -1687,6 +1710,59 @@ ulint buf_flush_LRU(ulint max_n)
   return n_flushed;
 }
 
+/** Run buf_pool.LRU batches until buf_pool.free is at least
+innodb_lru_scan_depth long or no more progress is being made. */
+static void buf_flush_LRU_worker(void*)
+{
+  mysql_mutex_lock(&buf_pool.mutex);
+  ulint n_free= UT_LIST_GET_LEN(buf_pool.free);
+
+  while (n_free < srv_LRU_scan_depth && buf_page_cleaner_is_active)
+  {
+    mysql_mutex_unlock(&buf_pool.mutex);
+    const ulint n_flushed= buf_flush_LRU(innodb_lru_flush_size);
+    if (n_flushed)
+    {
+      /* The written pages will be put to buf_pool.free by
+      buf_page_write_complete() */
+      buf_flush_wait_batch_end_acquiring_mutex(true);
+      MONITOR_INC_VALUE_CUMULATIVE(MONITOR_LRU_WORKER_TOTAL_PAGE,
+                                   MONITOR_LRU_WORKER_COUNT,
+                                   MONITOR_LRU_WORKER_PAGES,
+                                   n_flushed);
+    }
+    mysql_mutex_lock(&buf_pool.mutex);
+    buf_flush_LRU_worker_batches++;
+    buf_flush_LRU_worker_pages+= n_flushed;
+    const ulint n= UT_LIST_GET_LEN(buf_pool.free);
+    if (n <= n_free)
+      /* Either another thread is running an LRU batch, or
+      nothing could be evicted. Let buf_LRU_get_free_block()
+      take over, and retry on the next wake-up. */
+      break;
+    n_free= n;
+  }
+
+  buf_flush_LRU_worker_active= false;
+  mysql_mutex_unlock(&buf_pool.mutex);
+}
+
+/** The LRU flush worker of the page cleaner */
+static tpool::waitable_task buf_flush_LRU_worker_task(buf_flush_LRU_worker,
+                                                      nullptr);
+
+/** Start the LRU flush worker if innodb_lru_flush_worker is set and
+buf_pool.free is shorter than innodb_lru_scan_depth. */
+void buf_flush_LRU_worker_wake()
+{
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+  if (buf_flush_LRU_worker_active || !buf_flush_LRU_worker_enabled ||
+      UT_LIST_GET_LEN(buf_pool.free) >= srv_LRU_scan_depth)
+    return;
+  buf_flush_LRU_worker_active= true;
+  srv_thread_pool->submit_task(&buf_flush_LRU_worker_task);
+}
+
 /** Initiate a log checkpoint, discarding the start of the log.
 @param oldest_lsn   the checkpoint LSN
 @param end_lsn      log_sys.get_lsn()
@@ -2366,6 +2442,14 @@ static void buf_flush_page_cleaner()
 
   mysql_mutex_unlock(&buf_pool.flush_list_mutex);
 
+  /* Stop submitting the LRU flush worker, and wait for it. Any task
+  that was submitted before this will run to completion and reset
+  buf_flush_LRU_worker_active. */
+  mysql_mutex_lock(&buf_pool.mutex);
+  buf_flush_LRU_worker_enabled= false;
+  mysql_mutex_unlock(&buf_pool.mutex);
+  buf_flush_LRU_worker_task.disable();
+
   if (srv_fast_shutdown != 2)
   {
     buf_flush_wait_batch_end_acquiring_mutex(true);
@@ -2397,6 +2481,10 @@ ATTRIBUTE_COLD void buf_flush_page_cleaner_init()
   buf_flush_async_lsn= 0;
   buf_flush_sync_lsn= 0;
   buf_page_cleaner_is_active= true;
+  buf_flush_LRU_worker_task.enable();
+  mysql_mutex_lock(&buf_pool.mutex);
+  buf_flush_LRU_worker_enabled= true;
+  mysql_mutex_unlock(&buf_pool.mutex);
   std::thread(buf_flush_page_cleaner).detach();
 }
 
@@ -42,6 +42,9 @@ Created 11/5/1995 Heikki Tuuri
 /** Flush this many pages in buf_LRU_get_free_block() */
 size_t innodb_lru_flush_size;
 
+/** Whether a background worker keeps buf_pool.free replenished */
+my_bool innodb_lru_flush_worker;
+
 /** The number of blocks from the LRU_old pointer onward, including
 the block pointed to, must be buf_pool.LRU_old_ratio/BUF_LRU_OLD_RATIO_DIV
 of the whole LRU list length, except that the tolerance defined below
@@ -104,6 +107,9 @@ buf_LRU_stat_t	buf_LRU_stat_sum;
 /** Move blocks to "new" LRU list only if the first access was at
 least this many milliseconds ago.  Not protected by any mutex or latch. */
 uint	buf_LRU_old_threshold_ms;
+
+/** innodb_lru_policy: how accessed blocks are made young */
+ulong	buf_LRU_policy;
 /* @} */
 
 /** Remove bpage from buf_pool.LRU and buf_pool.page_hash.
@@ -243,6 +249,10 @@ static bool buf_LRU_free_from_common_LRU_list(ulint limit)
 
 		const auto accessed = bpage->is_accessed();
 
+		if (buf_LRU_second_chance(bpage)) {
+			continue;
+		}
+
 		if (buf_LRU_free_page(bpage, true)) {
 			if (!accessed) {
 				/* Keep track of pages that are evicted without
@@ -424,6 +434,9 @@ buf_block_t *buf_LRU_get_free_block(bool have_mutex)
 	/* If there is a block in the free list, take it */
 	if ((block = buf_LRU_get_free_only()) != nullptr) {
 got_block:
+		if (innodb_lru_flush_worker) {
+			buf_flush_LRU_worker_wake();
+		}
 		if (!have_mutex) {
 			mysql_mutex_unlock(&buf_pool.mutex);
 		}
@@ -783,6 +796,28 @@ void buf_page_make_young(buf_page_t *bpage)
   mysql_mutex_unlock(&buf_pool.mutex);
 }
 
+/** Give a block that was accessed while being too old a second chance,
+by moving it to the start of buf_pool.LRU instead of evicting it.
+@param bpage  block at the end of buf_pool.LRU
+@return whether the block was moved */
+bool buf_LRU_second_chance(buf_page_t *bpage)
+{
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+  ut_ad(bpage->in_LRU_list);
+
+  if (!bpage->referenced)
+    return false;
+
+  bpage->referenced= false;
+  if (bpage->old)
+    buf_pool.stat.n_pages_made_young++;
+
+  buf_LRU_remove_block(bpage);
+  buf_LRU_add_block(bpage, false);
+  MONITOR_INC(MONITOR_LRU_SECOND_CHANCE);
+  return true;
+}
+
 /** Try to free a block. If bpage is a descriptor of a compressed-only
 ROW_FORMAT=COMPRESSED page, the buf_page_t object will be freed as well.
 The caller must hold buf_pool.mutex.
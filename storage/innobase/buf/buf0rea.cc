@@ -105,19 +105,21 @@ static buf_page_t* buf_page_init_for_read(ulint mode, const page_id_t page_id,
 
   buf_page_t *bpage= nullptr;
   buf_block_t *block= nullptr;
+  const ulint fold= page_id.fold();
+
+  /* Allocate the block while holding buf_pool.mutex, so that a page
+  miss only acquires buf_pool.mutex once. */
+  mysql_mutex_lock(&buf_pool.mutex);
+
   if (!zip_size || unzip || recv_recovery_is_on())
   {
-    block= buf_LRU_get_free_block(false);
+    block= buf_LRU_get_free_block(true);
     block->initialise(page_id, zip_size);
     /* x_unlock() will be invoked
     in buf_page_read_complete() by the io-handler thread. */
     block->lock.x_lock(true);
   }
 
-  const ulint fold= page_id.fold();
-
-  mysql_mutex_lock(&buf_pool.mutex);
-
   buf_page_t *hash_page= buf_pool.page_hash_get_low(page_id, fold);
   if (hash_page && !buf_pool.watch_is_sentinel(*hash_page))
   {
@@ -713,6 +715,51 @@ buf_read_ahead_linear(const page_id_t page_id, ulint zip_size, bool ibuf)
   return count;
 }
 
+/** Issue an asynchronous read of the leaf page that an ascending index
+scan is going to visit after the current one (innodb_leaf_read_ahead).
+NOTE: the calling thread may own latches on pages.
+@param page_id   page identifier of the successor leaf page
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0 */
+void buf_read_ahead_leaf(const page_id_t page_id, ulint zip_size)
+{
+  if (!srv_leaf_read_ahead)
+    return;
+
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return;
+
+  if (ibuf_bitmap_page(page_id, zip_size) || trx_sys_hdr_page(page_id))
+    return;
+
+  if (buf_pool.n_pend_reads > buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return;
+
+  if (buf_pool.page_hash_contains(page_id))
+    return;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return;
+
+  if (page_id.page_no() > space->last_page_number() || space->is_stopping())
+  {
+    space->release();
+    return;
+  }
+
+  /* buf_read_page_low() will release the reference to space */
+  dberr_t err;
+  if (buf_read_page_low(&err, space, false, BUF_READ_ANY_PAGE, page_id,
+                        zip_size, false))
+  {
+    DBUG_PRINT("ib_buf", ("leaf read-ahead %u:%u",
+                          page_id.space(), page_id.page_no()));
+    buf_pool.stat.n_ra_pages_read++;
+    srv_stats.buf_pool_reads.add(1);
+  }
+}
+
 /** Issues read requests for pages which recovery wants to read in.
 @param space_id	tablespace identifier
 @param page_nos	page numbers to read, in ascending order */
@@ -75,6 +75,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "buf0buf.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "dict0boot.h"
 #include "dict0load.h"
 #include "btr0defragment.h"
@@ -341,6 +342,22 @@ static TYPELIB innodb_default_row_format_typelib = {
 	NULL
 };
 
+/** Possible values for system variable "innodb_lru_policy". */
+static const char* innodb_lru_policy_names[] = {
+	"midpoint",
+	"second_chance",
+	NullS
+};
+
+/** Used to define an enumerate type of the system variable
+innodb_lru_policy. */
+static TYPELIB innodb_lru_policy_typelib = {
+	array_elements(innodb_lru_policy_names) - 1,
+	"innodb_lru_policy_typelib",
+	innodb_lru_policy_names,
+	NULL
+};
+
 /** Names of allowed values of innodb_flush_method */
 const char* innodb_flush_method_names[] = {
 	"fsync",
@@ -889,6 +906,11 @@ static MYSQL_THDVAR_STR(tmpdir,
   "Directory for temporary non-tablespace files.",
   innodb_tmpdir_validate, NULL, NULL);
 
+static MYSQL_THDVAR_UINT(alter_sort_threads, PLUGIN_VAR_RQCMDARG,
+  "Maximum number of threads that ALTER TABLE uses for merge-sorting"
+  " the entries of new non-unique secondary indexes concurrently.",
+  NULL, NULL, 1, 1, 64, 0);
+
 static SHOW_VAR innodb_status_variables[]= {
 #ifdef BTR_CUR_HASH_ADAPT
   {"adaptive_hash_hash_searches", &export_vars.innodb_ahi_hit, SHOW_SIZE_T},
@@ -1917,6 +1939,14 @@ const char *thd_innodb_tmpdir(THD *thd)
 	return(tmp_dir);
 }
 
+/** Get the value of innodb_alter_sort_threads.
+@param[in]	thd	thread handle
+@return maximum number of concurrent index sorts */
+uint thd_innodb_alter_sort_threads(THD *thd)
+{
+	return(THDVAR(thd, alter_sort_threads));
+}
+
 /** Obtain the InnoDB transaction of a MySQL thread.
 @param[in,out]	thd	thread handle
 @return reference to transaction pointer */
@@ -7104,6 +7134,7 @@ build_template_field(
 	templ->rec_field_is_prefix = FALSE;
 	templ->rec_prefix_field_no = ULINT_UNDEFINED;
 	templ->is_virtual = !field->stored_in_db();
+	templ->is_topn_key = FALSE;
 
 	if (!templ->is_virtual) {
 		templ->col_no = i;
@@ -7612,6 +7643,56 @@ ha_innobase::build_template(
 			templ->rec_field_no = templ->clust_rec_field_no;
 		}
 	}
+
+	if (pushed_topn_filter) {
+		build_template_topn();
+	}
+}
+
+/** Mark the columns that the pushed top-N filter reads in
+m_prebuilt->mysql_template[], so that row_search_mvcc() can convert
+them before the rest of the row. The filter is not checked in InnoDB
+if one of those columns is missing from the template. */
+void ha_innobase::build_template_topn()
+{
+	m_prebuilt->topn_filter = this;
+
+	for (ulint j = 0; j < m_prebuilt->n_template; j++) {
+		m_prebuilt->mysql_template[j].is_topn_key = FALSE;
+	}
+
+	ulint	num_v = 0;
+
+	for (uint i = 0; i < table->s->fields; i++) {
+		const Field*	field = table->field[i];
+
+		if (!field->stored_in_db()) {
+			num_v++;
+			continue;
+		}
+
+		if (!pushed_topn_filter->depends_on(field)) {
+			continue;
+		}
+
+		mysql_row_templ_t*	templ = NULL;
+
+		for (ulint j = 0; j < m_prebuilt->n_template; j++) {
+			mysql_row_templ_t* t = &m_prebuilt->mysql_template[j];
+
+			if (!t->is_virtual && t->col_no == i - num_v) {
+				templ = t;
+				break;
+			}
+		}
+
+		if (!templ) {
+			m_prebuilt->topn_filter = NULL;
+			return;
+		}
+
+		templ->is_topn_key = TRUE;
+	}
 }
 
 /********************************************************************//**
@@ -9463,6 +9544,33 @@ ha_innobase::rnd_next(
 	DBUG_RETURN(error);
 }
 
+/** Start reading the root page of the index that is about to be scanned.
+ha_partition invokes this on all partitions before reading the first
+one, so that with innodb_leaf_read_ahead the I/O for the partitions
+that will be scanned later overlaps with the scan of the earlier ones.
+@param use_parallel	whether the whole partition set is likely to be
+			read (see ha_partition::check_parallel_search()) */
+void ha_innobase::read_ahead_root(bool use_parallel)
+{
+	if (!use_parallel || !srv_leaf_read_ahead) {
+		return;
+	}
+
+	const dict_index_t* index = m_prebuilt->index;
+
+	if (!index || !m_prebuilt->index_usable
+	    || index->table->is_temporary() || !index->table->space
+	    || index->page == FIL_NULL || index->is_corrupted()) {
+		return;
+	}
+
+	DBUG_EXECUTE_IF("ib_read_ahead_root",
+			ib::info() << "Read ahead of the root page of "
+			<< index->name << " in " << index->table->name;);
+	buf_read_ahead_leaf(page_id_t(index->table->space_id, index->page),
+			    index->table->space->zip_size());
+}
+
 /**********************************************************************//**
 Fetches a row from the table based on a row reference.
 @return 0, HA_ERR_KEY_NOT_FOUND, or error code */
@@ -18290,6 +18398,20 @@ buffer_pool_dump_now(
 	}
 }
 
+/** Update innodb_buffer_pool_dump_interval.
+@param[in]	save	immediate result from check function */
+static void
+innodb_buffer_pool_dump_interval_update(THD*, st_mysql_sys_var*, void*,
+					const void* save)
+{
+	srv_buf_pool_dump_interval = *static_cast<const uint*>(save);
+	if (!srv_read_only_mode) {
+		mysql_mutex_unlock(&LOCK_global_system_variables);
+		buf_dump_interval_update();
+		mysql_mutex_lock(&LOCK_global_system_variables);
+	}
+}
+
 /****************************************************************//**
 Trigger a load of the buffer pool if innodb_buffer_pool_load_now is set
 to ON. This function is registered as a callback with MySQL. */
@@ -18993,6 +19115,12 @@ static MYSQL_SYSVAR_ULONG(buffer_pool_dump_pct, srv_buf_pool_dump_pct,
   "Dump only the hottest N% of each buffer pool, defaults to 25",
   NULL, NULL, 25, 1, 100, 0);
 
+static MYSQL_SYSVAR_UINT(buffer_pool_dump_interval, srv_buf_pool_dump_interval,
+  PLUGIN_VAR_RQCMDARG,
+  "Dump the buffer pool into a file named @@innodb_buffer_pool_filename"
+  " every N seconds, so that it can be loaded after a crash (0=disabled)",
+  NULL, innodb_buffer_pool_dump_interval_update, 0, 0, 86400, 0);
+
 #ifdef UNIV_DEBUG
 /* Added to test the innodb_buffer_pool_load_incomplete status variable. */
 static MYSQL_SYSVAR_ULONG(buffer_pool_load_pages_abort, srv_buf_pool_load_pages_abort,
@@ -19086,6 +19214,12 @@ static MYSQL_SYSVAR_SIZE_T(lru_flush_size, innodb_lru_flush_size,
   "How many pages to flush on LRU eviction",
   NULL, NULL, 32, 1, SIZE_T_MAX, 0);
 
+static MYSQL_SYSVAR_BOOL(lru_flush_worker, innodb_lru_flush_worker,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether a background page cleaner worker should flush the LRU list"
+  " to keep innodb_lru_scan_depth free pages available",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_ULONG(flush_neighbors, srv_flush_neighbors,
   PLUGIN_VAR_OPCMDARG,
   "Set to 0 (don't flush neighbors from buffer pool),"
@@ -19106,6 +19240,12 @@ static MYSQL_SYSVAR_ENUM(deadlock_report, innodb_deadlock_report,
   "How to report deadlocks (if innodb_deadlock_detect=ON).",
   NULL, NULL, Deadlock::REPORT_FULL, &innodb_deadlock_report_typelib);
 
+static MYSQL_SYSVAR_UINT(deadlock_detect_delay, innodb_deadlock_detect_delay,
+  PLUGIN_VAR_RQCMDARG,
+  "Milliseconds to wait for a lock before checking for a deadlock"
+  " (if innodb_deadlock_detect=ON); 0 checks immediately.",
+  NULL, NULL, 0, 0, 1000, 0);
+
 static MYSQL_SYSVAR_UINT(fill_factor, innobase_fill_factor,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of B-tree page filled during bulk insert",
@@ -19215,6 +19355,18 @@ static MYSQL_SYSVAR_ULONG(log_write_ahead_size, srv_log_write_ahead_size,
   NULL, innodb_log_write_ahead_size_update,
   8*1024L, OS_FILE_LOG_BLOCK_SIZE, UNIV_PAGE_SIZE_DEF, OS_FILE_LOG_BLOCK_SIZE);
 
+static MYSQL_SYSVAR_BOOL(log_file_mmap, srv_log_file_mmap,
+  PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+  "Whether the redo log file should be written via a memory mapping"
+  " and flushed with msync() (not supported on Windows)",
+  NULL, NULL, FALSE);
+
+static MYSQL_SYSVAR_BOOL(log_pipelined_flush, srv_log_pipelined_flush,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether a transaction commit should write the redo log before waiting"
+  " for a concurrent redo log flush, so that writes and flushes overlap",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_UINT(old_blocks_pct, innobase_old_blocks_pct,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of the buffer pool to reserve for 'old' blocks.",
@@ -19227,6 +19379,15 @@ static MYSQL_SYSVAR_UINT(old_blocks_time, buf_LRU_old_threshold_ms,
   " The timeout is disabled if 0.",
   NULL, NULL, 1000, 0, UINT_MAX32, 0);
 
+static MYSQL_SYSVAR_ENUM(lru_policy, buf_LRU_policy,
+  PLUGIN_VAR_RQCMDARG,
+  "How blocks that are accessed after innodb_old_blocks_time are made"
+  " young. midpoint moves them to the start of the LRU list on access;"
+  " second_chance only marks them on access, without acquiring the"
+  " buffer pool mutex, and moves them when they reach the end of the"
+  " LRU list",
+  NULL, NULL, BUF_LRU_MIDPOINT, &innodb_lru_policy_typelib);
+
 static MYSQL_SYSVAR_ULONG(open_files, innobase_open_files,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "How many files at the maximum InnoDB keeps open at the same time.",
@@ -19398,6 +19559,14 @@ static MYSQL_SYSVAR_BOOL(random_read_ahead, srv_random_read_ahead,
   "Whether to use read ahead for random access within an extent.",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(leaf_read_ahead, srv_leaf_read_ahead,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether ascending index scans should read the next leaf page"
+  " asynchronously while the current one is being processed, and scans"
+  " of partitioned tables should start reading the root page of each"
+  " partition before the first partition is read.",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   PLUGIN_VAR_RQCMDARG,
   "Number of pages that must be accessed sequentially for InnoDB to"
@@ -19637,6 +19806,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_dump_now),
   MYSQL_SYSVAR(buffer_pool_dump_at_shutdown),
   MYSQL_SYSVAR(buffer_pool_dump_pct),
+  MYSQL_SYSVAR(buffer_pool_dump_interval),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buffer_pool_evict),
 #endif /* UNIV_DEBUG */
@@ -19654,6 +19824,8 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(defragment_frequency),
   MYSQL_SYSVAR(lru_scan_depth),
   MYSQL_SYSVAR(lru_flush_size),
+  MYSQL_SYSVAR(lru_flush_worker),
+  MYSQL_SYSVAR(lru_policy),
   MYSQL_SYSVAR(flush_neighbors),
   MYSQL_SYSVAR(checksum_algorithm),
   MYSQL_SYSVAR(compression_level),
@@ -19684,10 +19856,13 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(lock_wait_timeout),
   MYSQL_SYSVAR(deadlock_detect),
   MYSQL_SYSVAR(deadlock_report),
+  MYSQL_SYSVAR(deadlock_detect_delay),
   MYSQL_SYSVAR(page_size),
   MYSQL_SYSVAR(log_buffer_size),
   MYSQL_SYSVAR(log_file_size),
+  MYSQL_SYSVAR(log_file_mmap),
   MYSQL_SYSVAR(log_write_ahead_size),
+  MYSQL_SYSVAR(log_pipelined_flush),
   MYSQL_SYSVAR(log_group_home_dir),
   MYSQL_SYSVAR(max_dirty_pages_pct),
   MYSQL_SYSVAR(max_dirty_pages_pct_lwm),
@@ -19723,6 +19898,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(alter_sort_threads),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -19745,6 +19921,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(disallow_writes),
 #endif /* WITH_INNODB_DISALLOW_WRITES */
   MYSQL_SYSVAR(random_read_ahead),
+  MYSQL_SYSVAR(leaf_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
@@ -20383,6 +20560,26 @@ bool ha_innobase::rowid_filter_push(Rowid_filter* pk_filter)
 	DBUG_RETURN(false);
 }
 
+/** Push a top-N filter for a table scan.
+@param[in]	topn_filter	filter against which the rows
+				are to be checked
+@retval	false if pushed (always) */
+bool ha_innobase::topn_filter_push(Handler_topn_filter* topn_filter)
+{
+	DBUG_ENTER("ha_innobase::topn_filter_push");
+	DBUG_ASSERT(topn_filter != NULL);
+	pushed_topn_filter= topn_filter;
+	build_template_topn();
+	DBUG_RETURN(false);
+}
+
+/** Reset information about a pushed top-N filter */
+void ha_innobase::cancel_pushed_topn_filter()
+{
+	handler::cancel_pushed_topn_filter();
+	m_prebuilt->topn_filter = NULL;
+}
+
 static bool is_part_of_a_key_prefix(const Field_longstr *field)
 {
   const TABLE_SHARE *s= field->table->s;
@@ -159,6 +159,22 @@ class ha_innobase final : public handler
 
 	int rnd_pos(uchar * buf, uchar *pos) override;
 
+	/* Called by ha_partition on every partition before the scan
+	starts, see read_ahead_root(). */
+	int pre_index_read_map(const uchar*, key_part_map,
+			       enum ha_rkey_function, bool use_parallel)
+		override
+	{ read_ahead_root(use_parallel); return 0; }
+	int pre_index_first(bool use_parallel) override
+	{ read_ahead_root(use_parallel); return 0; }
+	int pre_index_last(bool use_parallel) override
+	{ read_ahead_root(use_parallel); return 0; }
+	int pre_read_range_first(const key_range*, const key_range*,
+				 bool, bool, bool use_parallel) override
+	{ read_ahead_root(use_parallel); return 0; }
+	int pre_rnd_next(bool use_parallel) override
+	{ read_ahead_root(use_parallel); return 0; }
+
 	int ft_init() override;
 	void ft_end() override { rnd_end(); }
 	FT_INFO *ft_init_ext(uint flags, uint inx, String* key) override;
@@ -425,6 +441,14 @@ class ha_innobase final : public handler
 	@retval	false if pushed (always) */
 	bool rowid_filter_push(Rowid_filter *rowid_filter) override;
 
+	/** Push a top-N filter for a table scan.
+	@param[in]	topn_filter	filter against which the rows
+					are to be checked
+	@retval	false if pushed (always) */
+	bool topn_filter_push(Handler_topn_filter *topn_filter) override;
+
+	void cancel_pushed_topn_filter() override;
+
 	bool
 	can_convert_string(const Field_string* field,
 			   const Column_definition& new_field) const override;
@@ -464,6 +488,7 @@ class ha_innobase final : public handler
 	void update_thd();
 
 	int general_fetch(uchar* buf, uint direction, uint match_mode);
+	void read_ahead_root(bool use_parallel);
 	int change_active_index(uint keynr);
 	dict_index_t* innobase_get_index(uint keynr);
 
@@ -482,6 +507,10 @@ class ha_innobase final : public handler
 	false if accessing individual fields is enough */
 	void build_template(bool whole_row);
 
+	/** Marks the columns of the pushed top-N filter in the template.
+	@see build_template() */
+	void build_template_topn();
+
 	int info_low(uint, bool);
 
 	/** The multi range read session object */
@@ -106,6 +106,8 @@ struct buf_pool_info_t
 	ulint	n_pending_flush_lru;	/*!< Pages pending flush in LRU */
 	ulint	n_pending_flush_list;	/*!< Pages pending flush in FLUSH
 					LIST */
+	ulint	n_LRU_worker_batches;	/*!< buf_flush_LRU_worker_batches */
+	ulint	n_LRU_worker_pages;	/*!< buf_flush_LRU_worker_pages */
 	ulint	n_pages_made_young;	/*!< number of pages made young */
 	ulint	n_pages_not_made_young;	/*!< number of pages not made young */
 	ulint	n_pages_read;		/*!< buf_pool.n_pages_read */
@@ -383,14 +385,11 @@ there is danger of dropping from the buffer pool.
 @return true if bpage should be made younger */
 inline bool buf_page_peek_if_too_old(const buf_page_t *bpage);
 
-/** Move a page to the start of the buffer pool LRU list if it is too old.
+/** Move a page to the start of the buffer pool LRU list if it is too old,
+or with innodb_lru_policy=second_chance, mark it for being moved there
+when it reaches the end of the LRU list.
 @param[in,out]	bpage		buffer pool page */
-inline void buf_page_make_young_if_needed(buf_page_t *bpage)
-{
-	if (UNIV_UNLIKELY(buf_page_peek_if_too_old(bpage))) {
-		buf_page_make_young(bpage);
-	}
-}
+inline void buf_page_make_young_if_needed(buf_page_t *bpage);
 
 /********************************************************************//**
 Increments the modify clock of a frame by 1. The caller must (1) own the
@@ -759,6 +758,11 @@ class buf_page_t
   /** Change buffer entries for the page exist.
   Protected by io_fix()==BUF_IO_READ or by buf_block_t::lock. */
   bool ibuf_exist;
+  /** Whether the page was accessed while being too old, and should be
+  moved to the start of buf_pool.LRU instead of being evicted
+  (innodb_lru_policy=second_chance). Set without holding any mutex,
+  reset while holding buf_pool.mutex. */
+  Atomic_relaxed<bool> referenced;
 
   /** Block initialization status. Can be modified while holding io_fix()
   or buf_block_t::lock X-latch */
@@ -792,6 +796,7 @@ class buf_page_t
     oldest_modification_= 0;
     slot= nullptr;
     ibuf_exist= false;
+    referenced= false;
     status= NORMAL;
     ut_d(in_zip_hash= false);
     ut_d(in_free_list= false);
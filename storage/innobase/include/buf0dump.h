@@ -41,4 +41,8 @@ void buf_load_at_startup();
 /** Wait for currently running load/dumps to finish*/
 void buf_load_dump_end();
 
+/** Start, stop or reschedule the periodic buffer pool dump
+after innodb_buffer_pool_dump_interval was changed. */
+void buf_dump_interval_update();
+
 #endif /* buf0dump_h */
@@ -39,6 +39,13 @@ extern ulint buf_lru_flush_page_count;
 /** Number of pages freed without flushing. Protected by buf_pool.mutex. */
 extern ulint buf_lru_freed_page_count;
 
+/** Number of batches run by the LRU flush worker.
+Protected by buf_pool.mutex. */
+extern ulint buf_flush_LRU_worker_batches;
+/** Number of pages flushed by the LRU flush worker.
+Protected by buf_pool.mutex. Also included in buf_lru_flush_page_count. */
+extern ulint buf_flush_LRU_worker_pages;
+
 /** Flag indicating if the page_cleaner is in active state. */
 extern Atomic_relaxed<bool> buf_page_cleaner_is_active;
 
@@ -107,6 +114,12 @@ bool buf_flush_list_space(fil_space_t *space, ulint *n_flushed= nullptr)
 @retval 0 if a buf_pool.LRU batch is already running */
 ulint buf_flush_LRU(ulint max_n);
 
+/** Start the LRU flush worker if innodb_lru_flush_worker is set and
+buf_pool.free is shorter than innodb_lru_scan_depth. The worker runs
+buf_pool.LRU batches in the background so that user threads seldom
+have to flush in buf_LRU_get_free_block(). */
+void buf_flush_LRU_worker_wake();
+
 /** Wait until a flush batch ends.
 @param lru    true=buf_pool.LRU; false=buf_pool.flush_list */
 void buf_flush_wait_batch_end(bool lru);
@@ -37,6 +37,9 @@ struct fil_space_t;
 /** Flush this many pages in buf_LRU_get_free_block() */
 extern size_t innodb_lru_flush_size;
 
+/** Whether a background worker keeps buf_pool.free replenished */
+extern my_bool innodb_lru_flush_worker;
+
 /*#######################################################################
 These are low-level functions
 #########################################################################*/
@@ -54,6 +57,12 @@ The caller must hold buf_pool.mutex.
 bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
   MY_ATTRIBUTE((nonnull));
 
+/** Give a block that was accessed while being too old a second chance,
+by moving it to the start of buf_pool.LRU instead of evicting it.
+@param bpage  block at the end of buf_pool.LRU
+@return whether the block was moved */
+bool buf_LRU_second_chance(buf_page_t *bpage);
+
 /** Try to free a replaceable block.
 @param limit  maximum number of blocks to scan
 @return true if found and freed */
@@ -173,6 +182,18 @@ The minimum must exceed
 /** Move blocks to "new" LRU list only if the first access was at
 least this many milliseconds ago.  Not protected by any mutex or latch. */
 extern uint	buf_LRU_old_threshold_ms;
+
+/** Values of innodb_lru_policy */
+enum buf_LRU_policy_t {
+	/** move accessed blocks to the start of buf_pool.LRU immediately */
+	BUF_LRU_MIDPOINT,
+	/** mark accessed blocks, and move them to the start of
+	buf_pool.LRU when they would be evicted */
+	BUF_LRU_SECOND_CHANCE
+};
+
+/** innodb_lru_policy: how accessed blocks are made young */
+extern ulong	buf_LRU_policy;
 /* @} */
 
 /** @brief Statistics for selecting the LRU list for eviction.
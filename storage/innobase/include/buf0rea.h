@@ -101,6 +101,16 @@ which could result in a deadlock if the OS does not support asynchronous io.
 ulint
 buf_read_ahead_linear(const page_id_t page_id, ulint zip_size, bool ibuf);
 
+/** Issue an asynchronous read of the leaf page that an ascending index
+scan is going to visit after the current one (innodb_leaf_read_ahead).
+Unlike buf_read_ahead_linear(), this does not depend on the leaf pages
+being allocated in the order of the key, so the I/O for the next page
+overlaps with processing the current page also on fragmented indexes.
+NOTE: the calling thread may own latches on pages.
+@param page_id   page identifier of the successor leaf page
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0 */
+void buf_read_ahead_leaf(const page_id_t page_id, ulint zip_size);
+
 /** Issue read requests for pages that need to be recovered.
 @param space_id	tablespace identifier
 @param page_nos	page numbers to read, in ascending order */
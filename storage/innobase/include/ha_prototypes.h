@@ -247,6 +247,11 @@ innobase_get_at_most_n_mbchars(
 @retval NULL if innodb_tmpdir="" */
 const char *thd_innodb_tmpdir(THD *thd);
 
+/** Get the value of innodb_alter_sort_threads.
+@param[in]	thd	thread handle
+@return maximum number of concurrent index sorts */
+uint thd_innodb_alter_sort_threads(THD *thd);
+
 /******************************************************************//**
 Returns the lock wait timeout for the current connection.
 @return the lock wait timeout, in seconds */
@@ -46,6 +46,8 @@ class ReadView;
 extern my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 extern ulong innodb_deadlock_report;
+/** The value of innodb_deadlock_detect_delay, in milliseconds */
+extern uint innodb_deadlock_detect_delay;
 
 namespace Deadlock
 {
@@ -367,6 +367,7 @@ class mapped_file_t
               bool nvme= false) noexcept;
   dberr_t unmap() noexcept;
   byte *data() noexcept { return m_area.data(); }
+  size_t size() const noexcept { return m_area.size(); }
 
 private:
   span<byte> m_area;
@@ -252,6 +252,11 @@ struct recv_sys_t
 				record, or 0 if none was parsed */
 	/** the time when progress was last reported */
 	time_t		progress_time;
+	/** number of pages to which log was applied in the current batch;
+	protected by mutex */
+	ulint		n_applied;
+	/** the time when the current batch was started */
+	time_t		batch_start_time;
 
   using map = std::map<const page_id_t, page_recv_t,
                        std::less<const page_id_t>,
@@ -453,9 +453,17 @@ struct mysql_row_templ_t {
 					type and this field is != 0, then
 					it is an unsigned integer type */
 	ulint	is_virtual;		/*!< if a column is a virtual column */
+	ulint	is_topn_key;		/*!< if the column is read by the
+					pushed top-N filter, and converted
+					before the rest of the row */
 };
 
+/* Number of rows to prefetch into fetch_cache in the first batch */
 #define MYSQL_FETCH_CACHE_SIZE		8
+/* Long scans double the batch size up to this many rows... */
+#define MYSQL_FETCH_CACHE_MAX_SIZE	64
+/* ...as long as the rows in fetch_cache take at most this many bytes */
+#define MYSQL_FETCH_CACHE_MAX_BYTES	65536
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
 
@@ -631,7 +639,7 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
-	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
+	byte*		fetch_cache[MYSQL_FETCH_CACHE_MAX_SIZE];
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
@@ -640,7 +648,13 @@ struct row_prebuilt_t {
 					pointers point 4 bytes past the
 					allocated mem buf start, because
 					there is a 4 byte magic number at the
-					start and at the end */
+					start and at the end; only the first
+					fetch_cache_slots() are allocated */
+	ulint		fetch_cache_size;/*!< maximum number of rows
+					to prefetch in the current batch;
+					starts at MYSQL_FETCH_CACHE_SIZE and
+					grows up to fetch_cache_slots()
+					while the cursor keeps fetching */
 	bool		keep_other_fields_on_keyread; /*!< when using fetch
 					cache with HA_EXTRA_KEYREAD, don't
 					overwrite other fields in mysql row
@@ -682,6 +696,10 @@ struct row_prebuilt_t {
 	ha_innobase*	idx_cond;
 	ulint		idx_cond_n_cols;/*!< Number of fields in idx_cond_cols.
 					0 if and only if idx_cond == NULL. */
+	/** Argument to handler_topn_filter_check(),
+	or NULL if no top-N filter is pushed for a table scan
+	or if mysql_template[] lacks some of its columns */
+	ha_innobase*	topn_filter;
 	/*----------------------*/
 
 	/*----------------------*/
@@ -701,6 +719,17 @@ struct row_prebuilt_t {
 	/** The MySQL table object */
 	TABLE*		m_mysql_table;
 
+	/** @return the number of allocated fetch_cache[] elements,
+	that is, the largest fetch_cache_size for mysql_row_len */
+	ulint fetch_cache_slots() const
+	{
+		return std::min<ulint>(
+			MYSQL_FETCH_CACHE_MAX_SIZE,
+			std::max<ulint>(MYSQL_FETCH_CACHE_SIZE,
+					MYSQL_FETCH_CACHE_MAX_BYTES
+					/ (mysql_row_len + 8)));
+	}
+
 	/** Get template by dict_table_t::cols[] number */
 	const mysql_row_templ_t* get_template_by_col(ulint col) const
 	{
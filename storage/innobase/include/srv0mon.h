@@ -219,6 +219,10 @@ enum monitor_id_t {
 	MONITOR_LRU_BATCH_SCANNED_PER_CALL,
 	MONITOR_LRU_BATCH_FLUSH_TOTAL_PAGE,
 	MONITOR_LRU_BATCH_EVICT_TOTAL_PAGE,
+	MONITOR_LRU_WORKER_TOTAL_PAGE,
+	MONITOR_LRU_WORKER_COUNT,
+	MONITOR_LRU_WORKER_PAGES,
+	MONITOR_LRU_SECOND_CHANCE,
 	MONITOR_LRU_SINGLE_FLUSH_FAILURE_COUNT,
 	MONITOR_LRU_GET_FREE_SEARCH,
 	MONITOR_LRU_SEARCH_SCANNED,
@@ -407,6 +411,7 @@ enum monitor_id_t {
 	MONITOR_ICP_NO_MATCH,
 	MONITOR_ICP_OUT_OF_RANGE,
 	MONITOR_ICP_MATCH,
+	MONITOR_TOPN_NO_MATCH,
 
 	/* This is used only for control system to turn
 	on/off and reset all monitor counters */
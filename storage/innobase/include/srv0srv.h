@@ -297,6 +297,12 @@ extern ulong	srv_log_buffer_size;
 extern ulong	srv_flush_log_at_trx_commit;
 extern uint	srv_flush_log_at_timeout;
 extern ulong	srv_log_write_ahead_size;
+/** innodb_log_pipelined_flush: whether log_write_up_to() writes the log
+before waiting for a concurrent log flush */
+extern my_bool	srv_log_pipelined_flush;
+/** innodb_log_file_mmap: whether the redo log is written via a
+memory mapping of the file */
+extern my_bool	srv_log_file_mmap;
 extern my_bool	srv_adaptive_flushing;
 extern my_bool	srv_flush_sync;
 
@@ -332,6 +338,8 @@ extern ulint	srv_buf_pool_base_size;
 extern ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 extern ulong	srv_buf_pool_dump_pct;
+/** Dump the buffer pool every this many seconds; 0=disabled */
+extern uint	srv_buf_pool_dump_interval;
 #ifdef UNIV_DEBUG
 /** Abort load after this amount of pages */
 extern ulong srv_buf_pool_load_pages_abort;
@@ -344,6 +352,7 @@ extern ulong	srv_checksum_algorithm;
 
 extern uint	srv_n_file_io_threads;
 extern my_bool	srv_random_read_ahead;
+extern my_bool	srv_leaf_read_ahead;
 extern ulong	srv_read_ahead_threshold;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
@@ -110,6 +110,13 @@ class ut_stage_alter_t {
 	inc(
 		ulint	inc_val = 1);
 
+	/** Flag records processed by a merge sort that was run without
+	this object, as if inc() had been called once for each of them.
+	@param[in]	n_recs	number of records processed */
+	void
+	inc_sorted(
+		ulint	n_recs);
+
 	/** Flag the end of reading of the primary key.
 	Here we know the exact number of pages and records and calculate
 	the number of records per page and refresh the estimate. */
@@ -314,6 +321,39 @@ ut_stage_alter_t::inc(ulint inc_val)
 	}
 }
 
+/** Flag records processed by a merge sort that was run without
+this object, as if inc() had been called once for each of them.
+@param[in]	n_recs	number of records processed */
+inline
+void
+ut_stage_alter_t::inc_sorted(
+	ulint	n_recs)
+{
+	if (m_progress == NULL) {
+		return;
+	}
+
+	ut_ad(m_cur_phase == SORT);
+
+	/* inc() reports every (m_n_recs_per_page * m_sort_multi_factor)-th
+	record during the sort phase. */
+	const double	every_nth = m_n_recs_per_page *
+		static_cast<double>(m_sort_multi_factor);
+
+	const ulint	k_before = static_cast<ulint>(
+		round(static_cast<double>(m_n_recs_processed) / every_nth));
+
+	m_n_recs_processed += n_recs;
+
+	const ulint	k_after = static_cast<ulint>(
+		round(static_cast<double>(m_n_recs_processed) / every_nth));
+
+	if (k_after > k_before) {
+		mysql_stage_inc_work_completed(m_progress, k_after - k_before);
+		reestimate();
+	}
+}
+
 /** Flag the end of reading of the primary key.
 Here we know the exact number of pages and records and calculate
 the number of records per page and refresh the estimate. */
@@ -480,6 +520,7 @@ class ut_stage_alter_t {
 
 	void inc() {}
 	void inc(ulint) {}
+	void inc_sorted(ulint) {}
 
 	void end_phase_read_pk() {}
 
@@ -56,6 +56,8 @@ Created 5/7/1996 Heikki Tuuri
 my_bool innodb_deadlock_detect;
 /** The value of innodb_deadlock_report */
 ulong innodb_deadlock_report;
+/** The value of innodb_deadlock_detect_delay, in milliseconds */
+uint innodb_deadlock_detect_delay;
 
 #ifdef HAVE_REPLICATION
 extern "C" void thd_rpl_deadlock_check(MYSQL_THD thd, MYSQL_THD other_thd);
@@ -1763,22 +1765,33 @@ dberr_t lock_wait(que_thr_t *thr)
   const bool no_timeout= innodb_lock_wait_timeout >= 100000000 ||
     ((type_mode & LOCK_TABLE) &&
      wait_lock->un_member.tab_lock.table->id <= DICT_FIELDS_ID);
+  /* With innodb_deadlock_detect_delay, most waits for a hot record
+  will end before the deadlock check is due, and the waits-for graph
+  will be traversed only for the longer waits. */
+  const uint deadlock_delay= innodb_deadlock_detect
+    ? innodb_deadlock_detect_delay : 0;
+  timespec deadlock_check_time;
+  if (deadlock_delay)
+  {
+    set_timespec_time_nsec(deadlock_check_time, suspend_time.val * 1000 +
+                           deadlock_delay * 1000000ULL);
+    if (!no_timeout && cmp_timespec(abstime, deadlock_check_time) < 0)
+      deadlock_check_time= abstime;
+  }
+  bool deadlock_check_pending= deadlock_delay != 0;
   thd_wait_begin(trx->mysql_thd, (type_mode & LOCK_TABLE)
                  ? THD_WAIT_TABLE_LOCK : THD_WAIT_ROW_LOCK);
   dberr_t error_state= DB_SUCCESS;
 
   mysql_mutex_lock(&lock_sys.wait_mutex);
-  if (trx->lock.wait_lock)
+  if (!trx->lock.wait_lock)
+    goto end_wait;
+  if (!deadlock_check_pending && Deadlock::check_and_resolve(trx))
   {
-    if (Deadlock::check_and_resolve(trx))
-    {
-      ut_ad(!trx->lock.wait_lock);
-      error_state= DB_DEADLOCK;
-      goto end_wait;
-    }
-  }
-  else
+    ut_ad(!trx->lock.wait_lock);
+    error_state= DB_DEADLOCK;
     goto end_wait;
+  }
 
   if (row_lock_wait)
     lock_sys.wait_start();
@@ -1794,7 +1807,24 @@ dberr_t lock_wait(que_thr_t *thr)
   {
     int err;
 
-    if (no_timeout)
+    if (deadlock_check_pending)
+    {
+      err= my_cond_timedwait(&trx->lock.cond, &lock_sys.wait_mutex.m_mutex,
+                             &deadlock_check_time);
+      if (err && trx->lock.wait_lock)
+      {
+        deadlock_check_pending= false;
+        if (Deadlock::check_and_resolve(trx))
+        {
+          ut_ad(!trx->lock.wait_lock);
+          error_state= DB_DEADLOCK;
+          break;
+        }
+        continue;
+      }
+      err= 0;
+    }
+    else if (no_timeout)
     {
       my_cond_wait(&trx->lock.cond, &lock_sys.wait_mutex.m_mutex);
       err= 0;
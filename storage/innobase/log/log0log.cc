@@ -236,10 +236,17 @@ dberr_t mapped_file_t::map(const char *path, bool read_only,
 
   const auto file_size= os_file_get_size(path).m_total_size;
 
-  const int nvme_flag= nvme ? MAP_SYNC : 0;
+#ifdef __linux__
+  const int flags= nvme ? MAP_SHARED_VALIDATE | MAP_SYNC : MAP_SHARED;
+#else
+  /* MAP_SHARED_VALIDATE and MAP_SYNC are Linux-specific; file_mmap_io
+  only needs a plain shared mapping, made durable by msync(). */
+  ut_ad(!nvme);
+  const int flags= MAP_SHARED;
+#endif
   void *ptr= my_mmap(0, static_cast<size_t>(file_size),
                      read_only ? PROT_READ : PROT_READ | PROT_WRITE,
-                     MAP_SHARED_VALIDATE | nvme_flag, fd, 0);
+                     flags, fd, 0);
   mysql_file_close(fd, MYF(MY_WME));
 
   if (ptr == MAP_FAILED)
@@ -373,6 +380,69 @@ class file_pmem_io final : public file_io
 };
 #endif
 
+#ifndef _WIN32
+/** Redo log file that is written by copying to a shared memory mapping
+and made durable by msync() of the range written since the previous
+flush() (innodb_log_file_mmap=ON) */
+class file_mmap_io final : public file_io
+{
+public:
+  dberr_t open(const char *path, bool read_only) noexcept final
+  {
+    return m_file.map(path, read_only);
+  }
+  dberr_t rename(const char *old_path, const char *new_path) noexcept final
+  {
+    return os_file_rename(innodb_log_file_key, old_path, new_path) ? DB_SUCCESS
+                                                                   : DB_ERROR;
+  }
+  dberr_t close() noexcept final { return m_file.unmap(); }
+  dberr_t read(os_offset_t offset, span<byte> buf) noexcept final
+  {
+    ut_ad(offset + buf.size() <= m_file.size());
+    memcpy(buf.data(), m_file.data() + offset, buf.size());
+    return DB_SUCCESS;
+  }
+  dberr_t write(const char *, os_offset_t offset,
+                span<const byte> buf) noexcept final
+  {
+    ut_ad(offset + buf.size() <= m_file.size());
+    memcpy(m_file.data() + offset, buf.data(), buf.size());
+    std::lock_guard<std::mutex> g(m_dirty_mutex);
+    m_dirty_start= std::min(m_dirty_start, offset);
+    m_dirty_end= std::max(m_dirty_end, offset + buf.size());
+    return DB_SUCCESS;
+  }
+  dberr_t flush() noexcept final
+  {
+    os_offset_t start, end;
+    {
+      std::lock_guard<std::mutex> g(m_dirty_mutex);
+      start= m_dirty_start;
+      end= m_dirty_end;
+      m_dirty_start= ~os_offset_t{0};
+      m_dirty_end= 0;
+    }
+    if (start >= end)
+      return DB_SUCCESS;
+    /* msync() requires the address to be aligned to the page size. */
+    start= ut_2pow_round(start, os_offset_t(my_getpagesize()));
+    return msync(m_file.data() + start, size_t(end - start), MS_SYNC)
+      ? DB_ERROR : DB_SUCCESS;
+  }
+
+private:
+  mapped_file_t m_file;
+  /** Protects m_dirty_start, m_dirty_end, because write() and flush()
+  may be invoked concurrently */
+  std::mutex m_dirty_mutex;
+  /** Start of the range that was written since the last flush() */
+  os_offset_t m_dirty_start= ~os_offset_t{0};
+  /** End of the range that was written since the last flush() */
+  os_offset_t m_dirty_end= 0;
+};
+#endif
+
 dberr_t log_file_t::open(bool read_only) noexcept
 {
   ut_a(!is_opened());
@@ -384,6 +454,11 @@ dberr_t log_file_t::open(bool read_only) noexcept
 #else
   auto ptr= std::unique_ptr<file_io>(new file_os_io);
 #endif
+#ifndef _WIN32
+  /* A persistent memory mapping is preferred, because it needs no msync() */
+  if (srv_log_file_mmap && !ptr->writes_are_durable())
+    ptr.reset(new file_mmap_io);
+#endif
 
   if (dberr_t err= ptr->open(m_path.c_str(), read_only))
     return err;
@@ -803,9 +878,22 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key,
     return;
   }
 
-  if (flush_to_disk &&
-      flush_lock.acquire(lsn, callback) != group_commit_lock::ACQUIRED)
-    return;
+  if (flush_to_disk)
+  {
+    if (srv_log_pipelined_flush && !rotate_key && !callback &&
+        lsn > flush_lock.value())
+    {
+      /* Write the log while another thread may be flushing it, so that
+      our flush_lock.acquire() will be satisfied by the next flush
+      without having to write the log first. An asynchronous request
+      (with callback) must not wait for write_lock here. */
+      log_write_up_to(lsn, false);
+      ut_ad(write_lock.value() >= lsn);
+    }
+
+    if (flush_lock.acquire(lsn, callback) != group_commit_lock::ACQUIRED)
+      return;
+  }
 
   if (write_lock.acquire(lsn, flush_to_disk ? nullptr : callback) ==
       group_commit_lock::ACQUIRED)
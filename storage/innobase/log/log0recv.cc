@@ -1277,6 +1277,8 @@ void recv_sys_t::create()
 	mlog_checkpoint_lsn = 0;
 
 	progress_time = time(NULL);
+	n_applied = 0;
+	batch_start_time = progress_time;
 	recv_max_page_lsn = 0;
 
 	memset(truncated_undo_spaces, 0, sizeof truncated_undo_spaces);
@@ -2756,9 +2758,12 @@ static void recv_recover_page(buf_block_t* block, mtr_t& mtr,
 	ut_ad(p->second.is_being_processed());
 	ut_ad(!recv_sys.pages.empty());
 
+	recv_sys.n_applied++;
+
 	if (recv_sys.report(now)) {
 		const ulint n = recv_sys.pages.size();
-		ib::info() << "To recover: " << n << " pages from log";
+		ib::info() << "To recover: " << n << " pages from log"
+			" (applied " << recv_sys.n_applied << " pages)";
 		service_manager_extend_timeout(
 			INNODB_EXTEND_TIMEOUT_INTERVAL, "To recover: " ULINTPF " pages from log", n);
 	}
@@ -3036,6 +3041,8 @@ void recv_sys_t::apply(bool last_batch)
 
     apply_log_recs= true;
     apply_batch_on= true;
+    n_applied= 0;
+    batch_start_time= time(nullptr);
 
     for (auto id= srv_undo_tablespaces_open; id--;)
     {
@@ -3164,6 +3171,17 @@ void recv_sys_t::apply(bool last_batch)
       mysql_mutex_unlock(&mutex);
       return;
     }
+
+    /* Pages that were not in the buffer pool were recovered by
+    recv_recover_page() in up to innodb_read_io_threads concurrent
+    read completion callbacks. */
+    const time_t elapsed= time(nullptr) - batch_start_time;
+    if (elapsed > 0)
+      ib::info() << "Applied log to " << n_applied << " pages in "
+                 << elapsed << " seconds ("
+                 << n_applied / ulint(elapsed) << " pages/s)";
+    else
+      ib::info() << "Applied log to " << n_applied << " pages";
   }
 
   if (last_batch)
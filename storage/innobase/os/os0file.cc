@@ -1295,6 +1295,11 @@ os_file_create_func(
 		os_file_set_nocache(file, name, mode_str);
 	}
 
+	if (*success && purpose == OS_FILE_AIO && srv_thread_pool) {
+		/* Let io_uring register the file */
+		srv_thread_pool->bind(file);
+	}
+
 #ifdef USE_FILE_LOCK
 	if (!read_only
 	    && *success
@@ -1321,6 +1326,9 @@ os_file_create_func(
 		}
 
 		*success = false;
+		if (purpose == OS_FILE_AIO && srv_thread_pool) {
+			srv_thread_pool->unbind(file);
+		}
 		close(file);
 		file = -1;
 	}
@@ -1516,6 +1524,9 @@ os_file_get_last_error.
 @return true if success */
 bool os_file_close_func(os_file_t file)
 {
+  /* The file descriptor can be reused as soon as it is closed */
+  if (srv_thread_pool)
+    srv_thread_pool->unbind(file);
   int ret= close(file);
 
   if (!ret)
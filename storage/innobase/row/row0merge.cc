@@ -3321,8 +3321,9 @@ row_merge_sort(
 	sol10-64 in buildbot.
 	*/
 #ifndef UNIV_SOLARIS
-	/* Progress report only for "normal" indexes. */
-	if (!(dup->index->type & DICT_FTS)) {
+	/* Progress report only for "normal" indexes, and not from
+	row_merge_sort_parallel(). */
+	if (update_progress && !(dup->index->type & DICT_FTS)) {
 		thd_progress_init(trx->mysql_thd, 1);
 	}
 #endif /* UNIV_SOLARIS */
@@ -3339,7 +3340,7 @@ row_merge_sort(
 		show processlist progress field */
 		/* Progress report only for "normal" indexes. */
 #ifndef UNIV_SOLARIS
-		if (!(dup->index->type & DICT_FTS)) {
+		if (update_progress && !(dup->index->type & DICT_FTS)) {
 			thd_progress_report(trx->mysql_thd, file->offset - num_runs, file->offset);
 		}
 #endif /* UNIV_SOLARIS */
@@ -3369,7 +3370,7 @@ row_merge_sort(
 
 	/* Progress report only for "normal" indexes. */
 #ifndef UNIV_SOLARIS
-	if (!(dup->index->type & DICT_FTS)) {
+	if (update_progress && !(dup->index->type & DICT_FTS)) {
 		thd_progress_end(trx->mysql_thd);
 	}
 #endif /* UNIV_SOLARIS */
@@ -4352,6 +4353,206 @@ row_merge_is_index_usable(
 			   index->table->name)));
 }
 
+/** A merge sort submitted to srv_thread_pool by row_merge_sort_parallel() */
+struct row_merge_psort_t
+{
+	/** transaction, for checking if the operation was interrupted */
+	trx_t*			trx;
+	/** index being created */
+	row_merge_dup_t		dup;
+	/** file containing the index entries */
+	merge_file_t*		file;
+	/** position of file in merge_files[] */
+	ulint			k;
+	/** position of the index in indexes[] */
+	ulint			i;
+	/** 3 buffers */
+	row_merge_block_t*	block;
+	ut_new_pfx_t		block_pfx;
+	/** encryption buffer, or NULL */
+	row_merge_block_t*	crypt_block;
+	ut_new_pfx_t		crypt_pfx;
+	/** temporary file handle */
+	pfs_os_file_t		tmpfd;
+	/** tablespace ID for encryption */
+	ulint			space;
+	/** number of runs in file before the sort */
+	ulint			n_runs;
+	/** the task */
+	tpool::waitable_task*	task;
+	/** result of row_merge_sort() */
+	dberr_t			error;
+};
+
+/** Run row_merge_sort() for a row_merge_psort_t.
+@param arg	row_merge_psort_t */
+static void row_merge_sort_task(void* arg)
+{
+	row_merge_psort_t*	psort = static_cast<row_merge_psort_t*>(arg);
+
+	psort->error = row_merge_sort(
+		psort->trx, &psort->dup, psort->file, psort->block,
+		&psort->tmpfd, false, 0.0, 0.0, psort->crypt_block,
+		psort->space);
+}
+
+/** Merge-sort the files of the new non-unique secondary indexes
+concurrently, using at most innodb_alter_sort_threads tasks at a time.
+Unlike the sorts of unique indexes, these cannot report duplicates into
+the MySQL table handle, so they are independent of each other.
+The tasks do not use the performance schema stage, which is not thread
+safe; the progress of each sort is reported here once it has finished.
+@param[in]	trx		transaction
+@param[in]	indexes		indexes to be created
+@param[in]	n_indexes	size of indexes[]
+@param[in,out]	merge_files	files of the non-spatial indexes
+@param[in]	table		MySQL table
+@param[in]	col_map		column map, or NULL
+@param[in]	space		tablespace ID for encryption
+@param[out]	sorted		for each file in merge_files[], whether
+				it was sorted here
+@param[out]	err_index	position of the failed index in indexes[]
+@param[in,out]	stage		performance schema accounting object
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_sort_parallel(
+	trx_t*			trx,
+	dict_index_t**		indexes,
+	ulint			n_indexes,
+	merge_file_t*		merge_files,
+	struct TABLE*		table,
+	const ulint*		col_map,
+	ulint			space,
+	bool*			sorted,
+	ulint*			err_index,
+	ut_stage_alter_t*	stage)
+{
+	const ulint	n_threads = thd_innodb_alter_sort_threads(
+		trx->mysql_thd);
+	std::vector<std::pair<ulint, ulint> >	todo;
+
+	for (ulint k = 0, i = 0; i < n_indexes; i++) {
+		const dict_index_t*	index = indexes[i];
+
+		if (dict_index_is_spatial(index)) {
+			continue;
+		}
+
+		if (!(index->type & DICT_FTS) && !dict_index_is_unique(index)
+		    && merge_files[k].fd != OS_FILE_CLOSED
+		    && merge_files[k].offset > 1) {
+			todo.push_back(std::make_pair(k, i));
+		}
+
+		k++;
+	}
+
+	if (n_threads < 2 || todo.size() < 2) {
+		return(DB_SUCCESS);
+	}
+
+	const ulint	n_slots = std::min<ulint>(n_threads, todo.size());
+	const size_t	block_size = 3 * srv_sort_buf_size;
+	const char*	path = thd_innodb_tmpdir(trx->mysql_thd);
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	std::vector<row_merge_psort_t>	slots(n_slots);
+	dberr_t		error = DB_SUCCESS;
+
+	for (ulint j = 0; j < n_slots; j++) {
+		row_merge_psort_t&	s = slots[j];
+
+		s.block = alloc.allocate_large(block_size, &s.block_pfx);
+		s.crypt_block = NULL;
+
+		if (s.block && log_tmp_is_encrypted()) {
+			s.crypt_block = alloc.allocate_large(
+				block_size, &s.crypt_pfx);
+			if (!s.crypt_block) {
+				alloc.deallocate_large(s.block, &s.block_pfx);
+				s.block = NULL;
+			}
+		}
+
+		if (!s.block) {
+			error = DB_OUT_OF_MEMORY;
+		}
+	}
+
+	for (ulint next = 0; error == DB_SUCCESS && next < todo.size(); ) {
+		ulint	n = 0;
+
+		for (; n < n_slots && next < todo.size(); n++, next++) {
+			row_merge_psort_t&	s = slots[n];
+
+			s.k = todo[next].first;
+			s.i = todo[next].second;
+			s.tmpfd = row_merge_file_create_low(path);
+
+			if (s.tmpfd == OS_FILE_CLOSED) {
+				error = DB_OUT_OF_MEMORY;
+				*err_index = s.i;
+				break;
+			}
+
+			MONITOR_ATOMIC_INC(MONITOR_ALTER_TABLE_SORT_FILES);
+
+			s.trx = trx;
+			s.dup.index = indexes[s.i];
+			s.dup.table = table;
+			s.dup.col_map = col_map;
+			s.dup.n_dup = 0;
+			s.file = &merge_files[s.k];
+			s.space = space;
+			s.n_runs = s.file->offset;
+			s.error = DB_SUCCESS;
+			s.task = new tpool::waitable_task(
+				row_merge_sort_task, &s);
+			srv_thread_pool->submit_task(s.task);
+		}
+
+		for (ulint j = 0; j < n; j++) {
+			row_merge_psort_t&	s = slots[j];
+
+			s.task->wait();
+			delete s.task;
+			row_merge_file_destroy_low(s.tmpfd);
+
+			if (s.error == DB_SUCCESS) {
+				sorted[s.k] = true;
+
+				/* row_merge_sort() would have invoked
+				stage->inc() for each record of each pass. */
+				if (stage != NULL) {
+					const double	passes
+						= log2(double(s.n_runs));
+					stage->begin_phase_sort(passes);
+					stage->inc_sorted(
+						ulint(s.file->n_rec)
+						* ulint(ceil(passes)));
+				}
+			} else if (error == DB_SUCCESS) {
+				error = s.error;
+				*err_index = s.i;
+			}
+		}
+	}
+
+	for (ulint j = 0; j < n_slots; j++) {
+		row_merge_psort_t&	s = slots[j];
+
+		if (s.block) {
+			alloc.deallocate_large(s.block, &s.block_pfx);
+		}
+
+		if (s.crypt_block) {
+			alloc.deallocate_large(s.crypt_block, &s.crypt_pfx);
+		}
+	}
+
+	return(error);
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -4402,6 +4603,7 @@ row_merge_build_indexes(
 	bool			allow_not_null)
 {
 	merge_file_t*		merge_files;
+	bool*			sorted = NULL;
 	row_merge_block_t*	block;
 	ut_new_pfx_t		block_pfx;
 	size_t			block_size;
@@ -4574,6 +4776,24 @@ row_merge_build_indexes(
 	/* Now we have files containing index entries ready for
 	sorting and inserting. */
 
+	sorted = static_cast<bool*>(
+		ut_zalloc_nokey(n_merge_files * sizeof *sorted));
+
+	if (sorted == NULL) {
+		error = DB_OUT_OF_MEMORY;
+		goto func_exit;
+	}
+
+	i = 0;
+	error = row_merge_sort_parallel(trx, indexes, n_indexes, merge_files,
+					table, col_map, new_table->space_id,
+					sorted, &i, stage);
+
+	if (error != DB_SUCCESS) {
+		trx->error_key_num = key_numbers[i];
+		goto func_exit;
+	}
+
 	for (ulint k = 0, i = 0; i < n_indexes; i++) {
 		dict_index_t*	sort_idx = indexes[i];
 
@@ -4632,7 +4852,9 @@ row_merge_build_indexes(
 						      pct_cost);
 			}
 
-			error = row_merge_sort(
+			error = sorted[k]
+				? DB_SUCCESS
+				: row_merge_sort(
 					trx, &dup, &merge_files[k],
 					block, &tmpfd, true,
 					pct_progress, pct_cost,
@@ -4759,6 +4981,7 @@ row_merge_build_indexes(
 	}
 
 	ut_free(merge_files);
+	ut_free(sorted);
 
 	alloc.deallocate_large(block, &block_pfx);
 
@@ -3836,10 +3836,10 @@ row_sel_prefetch_cache_init(
 	byte*	ptr;
 
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = prebuilt->fetch_cache_slots() * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < prebuilt->fetch_cache_slots(); i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3866,7 +3866,7 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
 	if (prebuilt->fetch_cache[0] == NULL) {
 		/* Allocate memory for the fetch cache */
@@ -4104,6 +4104,60 @@ row_search_idx_cond_check(
 	return(result);
 }
 
+/** Check a pushed top-N filter on a record of a table scan,
+converting only the columns that the filter reads to MySQL format.
+@param[out]	mysql_rec	record in MySQL format; only the columns
+				with templ->is_topn_key are valid
+@param[in,out]	prebuilt	prebuilt struct for the table handle
+@param[in]	rec		InnoDB record
+@param[in]	rec_clust	whether rec is a clustered index record
+				instead of a prebuilt->index record
+@param[in]	index		index of rec
+@param[in]	offsets		rec_get_offsets(rec)
+@return result of handler_topn_filter_check() */
+static
+check_result_t
+row_search_topn_check(
+	byte*			mysql_rec,
+	row_prebuilt_t*		prebuilt,
+	const rec_t*		rec,
+	bool			rec_clust,
+	const dict_index_t*	index,
+	const rec_offs*		offsets)
+{
+	if (UNIV_LIKELY_NULL(prebuilt->blob_heap)) {
+		mem_heap_empty(prebuilt->blob_heap);
+	}
+
+	for (ulint i = 0; i < prebuilt->n_template; i++) {
+		const mysql_row_templ_t*templ = &prebuilt->mysql_template[i];
+
+		if (!templ->is_topn_key) {
+			continue;
+		}
+
+		if (!row_sel_store_mysql_field(mysql_rec, prebuilt,
+					       rec, index, offsets,
+					       rec_clust
+					       ? templ->clust_rec_field_no
+					       : templ->rec_field_no,
+					       templ)) {
+			/* An incomplete externally stored column;
+			row_sel_store_mysql_rec() would skip the row. */
+			return(CHECK_NEG);
+		}
+	}
+
+	check_result_t result = handler_topn_filter_check(
+		prebuilt->topn_filter, mysql_rec);
+
+	if (result == CHECK_NEG) {
+		MONITOR_INC(MONITOR_TOPN_NO_MATCH);
+	}
+
+	return(result);
+}
+
 /** Extract virtual column data from a virtual index record and fill a dtuple
 @param[in]	rec		the virtual (secondary) index record
 @param[in]	index		the virtual index
@@ -4333,6 +4387,13 @@ row_search_mvcc(
 	ibool		table_lock_waited		= FALSE;
 	byte*		next_buf			= 0;
 	bool		spatial_search			= false;
+	/* Whether a pushed top-N filter is checked on each row. Then buf
+	only holds the columns that the filter reads, until the rest of
+	a row that passes the filter is converted. */
+	const bool	topn_check = prebuilt->topn_filter
+		&& prebuilt->select_lock_type == LOCK_NONE
+		&& prebuilt->template_type != ROW_MYSQL_DUMMY_TEMPLATE
+		&& !prebuilt->pk_filter && !prebuilt->idx_cond;
 
 	ut_ad(index && pcur && search_tuple);
 	ut_a(prebuilt->magic_n == ROW_PREBUILT_ALLOCATED);
@@ -4379,6 +4440,7 @@ row_search_mvcc(
 		prebuilt->n_rows_fetched = 0;
 		prebuilt->n_fetch_cached = 0;
 		prebuilt->fetch_cache_first = 0;
+		prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
 
 		if (prebuilt->sel_graph == NULL) {
 			/* Build a dummy select query graph */
@@ -4403,6 +4465,7 @@ row_search_mvcc(
 			prebuilt->n_rows_fetched = 0;
 			prebuilt->n_fetch_cached = 0;
 			prebuilt->fetch_cache_first = 0;
+			prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
 
 		} else if (UNIV_LIKELY(prebuilt->n_fetch_cached > 0)) {
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
@@ -4413,7 +4476,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_size) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -4429,6 +4493,23 @@ row_search_mvcc(
 			prebuilt->n_rows_fetched = 500000000;
 		}
 
+		/* The prefetch cache is empty. If the cursor has already
+		returned a couple of batches, let the next one be bigger,
+		so that long scans (such as those feeding COUNT(*) or
+		GROUP BY) store and restore the cursor position less
+		often, while short range scans and LIMIT queries do not
+		convert rows that will not be read. */
+		if (prebuilt->n_rows_fetched >= 2 * prebuilt->fetch_cache_size
+		    && prebuilt->fetch_cache_size
+		    < prebuilt->fetch_cache_slots()) {
+			prebuilt->fetch_cache_size = std::min(
+				2 * prebuilt->fetch_cache_size,
+				prebuilt->fetch_cache_slots());
+			DBUG_EXECUTE_IF("ib_fetch_cache_grow",
+					ib::info() << "fetch_cache_size="
+					<< prebuilt->fetch_cache_size;);
+		}
+
 		mode = pcur->search_mode;
 	}
 
@@ -5548,6 +5629,23 @@ row_search_mvcc(
 				offsets));
 	ut_ad(!rec_get_deleted_flag(result_rec, comp));
 
+	if (topn_check) {
+		/* Skip the rows that cannot get into the result of
+		an ORDER BY...LIMIT before converting them in full. */
+		switch (row_search_topn_check(
+				buf, prebuilt, result_rec, result_rec != rec,
+				result_rec != rec ? clust_index : index,
+				offsets)) {
+		case CHECK_NEG:
+			goto next_rec;
+		case CHECK_ABORTED_BY_USER:
+			err = DB_INTERRUPTED;
+			goto idx_cond_failed;
+		default:
+			break;
+		}
+	}
+
 	/* Decide whether to prefetch extra rows.
 	At this point, the clustered index record is protected
 	by a page latch that was acquired when pcur was positioned.
@@ -5571,7 +5669,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5589,9 +5687,13 @@ row_search_mvcc(
 			If the conversion fails and the MySQL record buffer
 			was not written to then we reset next_buf so that
 			we can re-use the MySQL record buffer in the next
-			iteration. */
+			iteration.
 
-			next_buf = next_buf
+			With a top-N filter, buf is needed for checking
+			the following rows, so all rows are converted into
+			pre-fetch buffers. */
+
+			next_buf = next_buf || topn_check
 				 ? row_sel_fetch_last_buf(prebuilt) : buf;
 
 			if (!row_sel_store_mysql_rec(
@@ -5623,7 +5725,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_cache_size) {
 			goto next_rec;
 		}
 
@@ -5880,11 +5982,12 @@ row_search_mvcc(
 
 	DEBUG_SYNC_C("row_search_for_mysql_before_return");
 
-	if (prebuilt->pk_filter || prebuilt->idx_cond) {
-		/* When ICP is active we don't write to the MySQL buffer
-		directly, only to buffers that are enqueued in the pre-fetch
-		queue. We need to dequeue the first buffer and copy the contents
-		to the record buffer that was passed in by MySQL. */
+	if (prebuilt->pk_filter || prebuilt->idx_cond || topn_check) {
+		/* When ICP or a top-N filter is active we don't write to
+		the MySQL buffer directly, only to buffers that are enqueued
+		in the pre-fetch queue. We need to dequeue the first buffer
+		and copy the contents to the record buffer that was passed
+		in by MySQL. */
 
 		if (prebuilt->n_fetch_cached > 0) {
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
@@ -496,6 +496,28 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
 	 MONITOR_DEFAULT_START, MONITOR_LRU_BATCH_EVICT_TOTAL_PAGE},
 
+	/* Cumulative counter for LRU flush worker batches */
+	{"buffer_LRU_worker_total_pages", "buffer",
+	 "Total pages flushed by the LRU flush worker",
+	 MONITOR_SET_OWNER, MONITOR_LRU_WORKER_COUNT,
+	 MONITOR_LRU_WORKER_TOTAL_PAGE},
+
+	{"buffer_LRU_worker", "buffer",
+	 "Number of LRU flush worker batches",
+	 MONITOR_SET_MEMBER, MONITOR_LRU_WORKER_TOTAL_PAGE,
+	 MONITOR_LRU_WORKER_COUNT},
+
+	{"buffer_LRU_worker_pages", "buffer",
+	 "Pages queued as an LRU flush worker batch",
+	 MONITOR_SET_MEMBER, MONITOR_LRU_WORKER_TOTAL_PAGE,
+	 MONITOR_LRU_WORKER_PAGES},
+
+	{"buffer_LRU_second_chance", "buffer",
+	 "Number of blocks moved to the start of the LRU list instead of"
+	 " being evicted (innodb_lru_policy=second_chance)",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LRU_SECOND_CHANCE},
+
 	{"buffer_LRU_single_flush_failure_count", "Buffer",
 	 "Number of times attempt to flush a single page from LRU failed",
 	 MONITOR_NONE,
@@ -1224,6 +1246,11 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_ICP_MATCH},
 
+	{"topn_no_match", "icp",
+	 "Rows skipped by an ORDER BY...LIMIT filter pushed into a table scan",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_TOPN_NO_MATCH},
+
 	/* ========== To turn on/off reset all counters ========== */
 	{"all", "All Counters", "Turn on/off and reset all counters",
 	 MONITOR_MODULE,
@@ -169,6 +169,12 @@ ulong		srv_page_size;
 uint32_t	srv_page_size_shift;
 /** innodb_log_write_ahead_size */
 ulong		srv_log_write_ahead_size;
+/** innodb_log_pipelined_flush: whether log_write_up_to() writes the log
+before waiting for a concurrent log flush */
+my_bool		srv_log_pipelined_flush;
+/** innodb_log_file_mmap: whether the redo log is written via a
+memory mapping of the file */
+my_bool		srv_log_file_mmap;
 
 /** innodb_adaptive_flushing; try to flush dirty pages so as to avoid
 IO bursts at the checkpoints. */
@@ -209,6 +215,8 @@ ulint	srv_buf_pool_base_size;
 ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 ulong	srv_buf_pool_dump_pct;
+/** Dump the buffer pool every this many seconds; 0=disabled */
+uint	srv_buf_pool_dump_interval;
 /** Abort load after this amount of pages */
 #ifdef UNIV_DEBUG
 ulong srv_buf_pool_load_pages_abort = LONG_MAX;
@@ -226,6 +234,8 @@ uint	srv_n_write_io_threads;
 
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
+/** innodb_leaf_read_ahead */
+my_bool	srv_leaf_read_ahead;
 /** innodb_read_ahead_threshold; the number of pages that must be present
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
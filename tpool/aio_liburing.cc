@@ -17,6 +17,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include "tpool.h"
 #include "mysql/service_my_print_error.h"
 #include "mysqld_error.h"
+#include <my_global.h>
+#include <my_dbug.h>
 
 #include <liburing.h>
 
@@ -24,6 +26,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <utility>
 
 namespace
 {
@@ -63,6 +66,14 @@ class aio_uring final : public tpool::aio
       throw std::runtime_error("aio_uring()");
     }
 
+    // Register a sparse table, so that bind() can install the data files
+    // as fixed files and spare the kernel the file descriptor lookup on
+    // every request. If this is not supported, plain descriptors are used.
+    fixed_files_.assign(MAX_FIXED_FILES, -1);
+    if (io_uring_register_files(&uring_, fixed_files_.data(),
+                                unsigned(fixed_files_.size())) != 0)
+      fixed_files_.clear();
+
     thread_= std::thread(thread_routine, this);
   }
 
@@ -85,6 +96,17 @@ class aio_uring final : public tpool::aio
     }
     thread_.join();
     io_uring_queue_exit(&uring_);
+#ifndef DBUG_OFF
+    if (fixed_files_.empty())
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring: registered files are not supported",
+                      ME_ERROR_LOG | ME_NOTE);
+    else
+      my_printf_error(ER_UNKNOWN_ERROR,
+                      "io_uring: %zu requests were submitted"
+                      " on registered files",
+                      ME_ERROR_LOG | ME_NOTE, fixed_submissions_);
+#endif
   }
 
   int submit_io(tpool::aiocb *cb) final
@@ -96,13 +118,29 @@ class aio_uring final : public tpool::aio
     // must be atomical. This is because liburing provides thread-unsafe calls.
     std::lock_guard<std::mutex> _(mutex_);
 
+    int fd= cb->m_fh;
+    bool fixed= false;
+    auto it= find_fixed_file(cb->m_fh);
+    if (it != fixed_slots_.end() && it->first == cb->m_fh)
+    {
+      fd= int(it->second);
+      fixed= true;
+    }
+
     io_uring_sqe *sqe= io_uring_get_sqe(&uring_);
     if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
-      io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
+      io_uring_prep_readv(sqe, fd, static_cast<struct iovec *>(cb), 1,
                           cb->m_offset);
     else
-      io_uring_prep_writev(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
+      io_uring_prep_writev(sqe, fd, static_cast<struct iovec *>(cb), 1,
                            cb->m_offset);
+    if (fixed)
+    {
+      sqe->flags|= IOSQE_FIXED_FILE;
+#ifndef DBUG_OFF
+      fixed_submissions_++;
+#endif
+    }
     io_uring_sqe_set_data(sqe, cb);
 
     return io_uring_submit(&uring_) == 1 ? 0 : -1;
@@ -110,22 +148,31 @@ class aio_uring final : public tpool::aio
 
   int bind(native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(it == files_.end() || *it != fd);
-    files_.insert(it, fd);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    std::lock_guard<std::mutex> _(mutex_);
+    auto it= find_fixed_file(fd);
+    assert(it == fixed_slots_.end() || it->first != fd);
+    auto slot= std::find(fixed_files_.begin(), fixed_files_.end(), -1);
+    if (slot == fixed_files_.end())
+      return 0; // no free slot: submit_io() will use the descriptor
+    const unsigned n= unsigned(slot - fixed_files_.begin());
+    if (io_uring_register_files_update(&uring_, n, &fd, 1) != 1)
+      return 0;
+    *slot= fd;
+    fixed_slots_.emplace(it, fd, n);
+    return 0;
   }
 
   int unbind(const native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(*it == fd);
-    files_.erase(it);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    std::lock_guard<std::mutex> _(mutex_);
+    auto it= find_fixed_file(fd);
+    if (it == fixed_slots_.end() || it->first != fd)
+      return 0;
+    const unsigned n= it->second;
+    fixed_slots_.erase(it);
+    fixed_files_[n]= -1;
+    int none= -1;
+    return io_uring_register_files_update(&uring_, n, &none, 1) == 1 ? 0 : -1;
   }
 
 private:
@@ -174,13 +221,33 @@ class aio_uring final : public tpool::aio
     }
   }
 
+  typedef std::vector<std::pair<native_file_handle, unsigned>> slots_t;
+
+  /** @return the position of fd in fixed_slots_, or where it would be */
+  slots_t::iterator find_fixed_file(native_file_handle fd)
+  {
+    return std::lower_bound(fixed_slots_.begin(), fixed_slots_.end(), fd,
+                            [](const slots_t::value_type &a,
+                               native_file_handle b) { return a.first < b; });
+  }
+
+  /** Size of the registered file table */
+  static constexpr unsigned MAX_FIXED_FILES= 1024;
+
   io_uring uring_;
+  /** Protects uring_ submissions, fixed_files_ and fixed_slots_ */
   std::mutex mutex_;
   tpool::thread_pool *tpool_;
   std::thread thread_;
 
-  std::vector<native_file_handle> files_;
-  std::mutex files_mutex_;
+  /** Registered file table: descriptor in each slot, or -1 if free */
+  std::vector<native_file_handle> fixed_files_;
+  /** (descriptor, slot) pairs of the registered files, sorted */
+  slots_t fixed_slots_;
+#ifndef DBUG_OFF
+  /** Number of requests submitted with IOSQE_FIXED_FILE */
+  size_t fixed_submissions_= 0;
+#endif
 };
 
 } // namespace
@@ -0,0 +1,78 @@
+/* Copyright (c) 2021, MariaDB Corporation
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <my_rnd.h>
+#include "tap.h"
+
+#define MAX_ITEMS 20000
+#define MAX_SIZE 48
+
+static uchar keys[MAX_ITEMS][MAX_SIZE];
+static uchar *ptrs[MAX_ITEMS], *buffer[MAX_ITEMS];
+
+/* Fill the keys with a common prefix and few distinct bytes after it */
+static void fill(struct my_rnd_struct *rnd, uint items, size_t size,
+                 uint distinct)
+{
+  uint i;
+  size_t j;
+  for (i= 0; i < items; i++)
+  {
+    for (j= 0; j < size; j++)
+      keys[i][j]= j < size / 4 ? 'p' : (uchar) (my_rnd(rnd) * distinct);
+    ptrs[i]= keys[i];
+  }
+}
+
+static my_bool is_sorted(uint items, size_t size)
+{
+  uint i;
+  for (i= 1; i < items; i++)
+    if (memcmp(ptrs[i - 1], ptrs[i], size) > 0)
+      return 0;
+  return 1;
+}
+
+int main(int argc __attribute__((unused)), char *argv[])
+{
+  struct my_rnd_struct rnd;
+  static const size_t sizes[]= {1, 8, 20, 33, MAX_SIZE};
+  uint i;
+  MY_INIT(argv[0]);
+  plan(2 * array_elements(sizes) + 1);
+
+  my_rnd_init(&rnd, 1, 2);
+
+  for (i= 0; i < array_elements(sizes); i++)
+  {
+    fill(&rnd, MAX_ITEMS, sizes[i], 256);
+    radixsort_msd_for_str_ptr(ptrs, MAX_ITEMS, sizes[i], buffer);
+    ok(is_sorted(MAX_ITEMS, sizes[i]), "msd size %u random",
+       (uint) sizes[i]);
+    fill(&rnd, MAX_ITEMS, sizes[i], 3);
+    radixsort_msd_for_str_ptr(ptrs, MAX_ITEMS, sizes[i], buffer);
+    ok(is_sorted(MAX_ITEMS, sizes[i]), "msd size %u few values",
+       (uint) sizes[i]);
+  }
+
+  fill(&rnd, 5000, 20, 256);
+  radixsort_for_str_ptr(ptrs, 5000, 20, buffer);
+  ok(is_sorted(5000, 20), "lsd size 20");
+
+  my_end(0);
+  return exit_status();
+}